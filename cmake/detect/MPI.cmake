@@ -230,6 +230,26 @@ set(MPIX_IALLGATHER_CODE
      }")
 El_check_c_source_compiles("${MPIX_IALLGATHER_CODE}" 
   EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
+set(MPI_NEIGHBOR_COLLECTIVES_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       int ranks[1] = {0}, counts[1] = {1}, offs[1] = {0};
+       double a[1], b[1];
+       MPI_Comm graphComm;
+       MPI_Request request;
+       MPI_Dist_graph_create_adjacent
+       ( MPI_COMM_WORLD, 1, ranks, MPI_UNWEIGHTED, 1, ranks, MPI_UNWEIGHTED,
+         MPI_INFO_NULL, 0, &graphComm );
+       MPI_Ineighbor_alltoallv
+       ( a, counts, offs, MPI_DOUBLE,
+         b, counts, offs, MPI_DOUBLE, graphComm, &request );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${MPI_NEIGHBOR_COLLECTIVES_CODE}"
+  EL_HAVE_MPI_NEIGHBOR_COLLECTIVES)
 set(MPI_INIT_THREAD_CODE
     "#include \"mpi.h\"
      int main( int argc, char* argv[] )
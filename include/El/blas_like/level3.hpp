@@ -26,11 +26,64 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  // GEMM_SUMMA_C with the panel gathers overlapped with the local updates
+  // via non-blocking collectives (other orientations use GEMM_SUMMA_C)
+  GEMM_SUMMA_C_PIPELINED,
+  // SUMMA within each of several layers of the process grid which split the
+  // summation dimension (see Gemm25DDepth)
+  GEMM_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The alpha-beta-gamma machine model used to choose among the SUMMA variants
+// when GEMM_DEFAULT is requested. Every process in a grid must use the same
+// model so that they all select the same variant.
+struct GemmCostModel
+{
+    // Seconds per message (alpha)
+    double latency=1.e-6;
+    // Seconds per byte communicated (beta)
+    double inverseBandwidth=1.e-9;
+    // Seconds per real floating-point operation (gamma)
+    double flopTime=1.e-10;
+    // The panel size of the dot-product variant (GEMM_SUMMA_DOT)
+    Int blockSizeDot=2000;
+};
+void SetGemmCostModel( const GemmCostModel& model );
+GemmCostModel GetGemmCostModel();
+
+// Time collectives over the grid and a local Gemm in order to estimate the
+// model's constants. This must be called by every process in the grid, and
+// the (maximum) measured constants are returned on every process.
+GemmCostModel CalibrateGemmCostModel
+( const Grid& grid=Grid::Default(), Int numReps=10 );
+
+// The predicted time of a SUMMA variant for forming an m x n product with an
+// inner dimension of sumDim using entries which occupy typeSize bytes when
+// packed for communication (see SerializedSize)
+double GemmCost
+( GemmAlgorithm alg, Int m, Int n, Int sumDim,
+  const Grid& grid, Int typeSize,
+  const GemmCostModel& model=GetGemmCostModel() );
+
+// The SUMMA variant with the least predicted cost
+GemmAlgorithm SelectGemmAlgorithm
+( Int m, Int n, Int sumDim, const Grid& grid, Int typeSize,
+  const GemmCostModel& model=GetGemmCostModel() );
+
+// The number of bytes per process that GEMM_25D may use for its copies of
+// the local portions of A, B, and C. If the limit is zero (the default),
+// Grid::FreeMemoryPerProcess is used, which is queried once per grid.
+void SetGemm25DMemoryLimit( double numBytes );
+double Gemm25DMemoryLimit();
+
+// The number of layers used by GEMM_25D: the largest divisor c of the grid
+// size with c^3 <= p such that c copies of C fit within the memory limit.
+// This must be called by every process in the grid.
+Int Gemm25DDepth( Int m, Int n, Int sumDim, const Grid& grid, Int typeSize );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -31,6 +31,13 @@ struct DistGraphMultMeta
     vector<int> sendSizes, sendOffs,
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
+    // Plans for exchanging values with the other processes which we share
+    // indices with, for both normal and adjoint multiplication
+    mpi::NeighborPlan plan, adjointPlan;
+    // The local sources whose targets are all owned by this process, which
+    // can therefore be multiplied while the remaining (boundary) sources wait
+    // on communication
+    vector<Int> interiorSources, boundarySources;
 
     DistGraphMultMeta() : ready(false), numRecvInds(0) { }
 
@@ -44,6 +51,10 @@ struct DistGraphMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        plan.Clear();
+        adjointPlan.Clear();
+        SwapClear( interiorSources );
+        SwapClear( boundarySources );
     }
 
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
@@ -56,6 +67,10 @@ struct DistGraphMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        plan = meta.plan;
+        adjointPlan = meta.adjointPlan;
+        interiorSources = meta.interiorSources;
+        boundarySources = meta.boundarySources;
         return *this;
     }
 };
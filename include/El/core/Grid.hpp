@@ -84,6 +84,12 @@ public:
     EL_NO_RELEASE_EXCEPT;
     int VCToViewing( int VCRank ) const EL_NO_EXCEPT;
 
+    // The minimum over the grid of the free physical memory of each node
+    // split between the grid processes which share it (or 1 GB if it cannot
+    // be queried). The first call must be made by every process in the grid;
+    // the result is cached afterwards.
+    double FreeMemoryPerProcess() const;
+
 #ifdef EL_HAVE_SCALAPACK
     // TODO(poulson): More distribution contexts and handles
     int BlacsVCHandle() const;
@@ -103,6 +109,7 @@ private:
     int height_, size_, gcd_;
     bool inGrid_;
     GridOrder order_;
+    mutable double freeMemoryPerProcess_;
 
     static Grid* defaultGrid;
 
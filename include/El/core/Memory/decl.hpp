@@ -11,11 +11,89 @@
 
 namespace El {
 
+namespace MemoryModeNS {
+enum MemoryMode
+{
+    SYSTEM_MEMORY_MODE, // Request every buffer directly from the system
+    POOLED_MEMORY_MODE  // Recycle buffers through power-of-two size classes
+};
+}
+using namespace MemoryModeNS;
+
+// Buffers acquired under one mode may safely be released under the other,
+// so the mode can be switched at any point (e.g., around a blocked loop)
+void SetMemoryMode( MemoryMode mode );
+MemoryMode GetMemoryMode();
+
+// The byte alignment of each Memory<G>::Buffer(); it must be a power of two
+void SetMemoryAlignment( size_t alignment );
+size_t MemoryAlignment();
+
+// The maximum number of idle bytes the pool may hold onto before returning
+// freed blocks directly to the system
+void SetMaxPooledBytes( size_t maxPooledBytes );
+size_t MaxPooledBytes();
+
+// The number of idle bytes currently held by the pool
+size_t PooledBytes();
+
+// Return all idle pooled blocks to the system
+void ReleasePooledMemory();
+
+struct MemoryStats
+{
+    size_t numAllocs=0;
+    size_t numFrees=0;
+    size_t numBytesLive=0;
+    size_t peakBytesLive=0;
+    size_t numPoolHits=0;
+    size_t numPoolMisses=0;
+};
+
+// Per-datatype statistics for the buffers owned by Memory<G>
+template<typename G>
+MemoryStats GetMemoryStats();
+template<typename G>
+void ResetMemoryStats();
+void PrintMemoryStats
+( const MemoryStats& stats, const string& label, ostream& os=cout );
+
+namespace memory {
+
+// The counters are atomic so that allocations in the system mode need not
+// serialize on the pool's lock
+struct AtomicStats
+{
+    std::atomic<size_t> numAllocs{0};
+    std::atomic<size_t> numFrees{0};
+    std::atomic<size_t> numBytesLive{0};
+    std::atomic<size_t> peakBytesLive{0};
+    std::atomic<size_t> numPoolHits{0};
+    std::atomic<size_t> numPoolMisses{0};
+};
+
+// The untyped allocator underlying Memory<G>. The returned block is aligned
+// to the (power-of-two) 'alignment', and 'capacity' returns the number of
+// bytes actually reserved, which must be passed back into Free.
+void* Allocate
+( size_t numBytes, size_t alignment, size_t& capacity, AtomicStats& stats );
+void Free( void* ptr, size_t capacity, AtomicStats& stats );
+
+template<typename G>
+AtomicStats& Stats()
+{
+    static AtomicStats stats;
+    return stats;
+}
+
+} // namespace memory
+
 template<typename G>
 class Memory
 {
     size_t size_;
-    G* rawBuffer_;
+    size_t rawSize_;
+    void* rawBuffer_;
     G* buffer_;
 public:
     Memory();
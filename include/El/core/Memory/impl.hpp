@@ -11,34 +11,67 @@ namespace El {
 
 namespace {
 
+// The number of bytes reserved after the entries for their internal storage
 template<typename G>
-static G* New( size_t size )
+size_t ArenaBytes( size_t size ) { return 0; }
+
+template<typename G,typename=EnableIf<IsPacked<G>>>
+void Construct( G* buffer, size_t size, void* arena ) { }
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+void Construct( G* buffer, size_t size, void* arena )
 {
-    return new G[size];
+    // Destroy the entries constructed so far if any constructor throws
+    size_t i=0;
+    try
+    {
+        for( ; i<size; ++i )
+            new(&buffer[i]) G;
+    }
+    catch( ... )
+    {
+        while( i > 0 )
+            buffer[--i].~G();
+        throw;
+    }
 }
 
-template<typename G>
-static void Delete( G*& ptr )
+#ifdef EL_HAVE_MPC
+template<>
+size_t ArenaBytes<BigFloat>( size_t size ) { return mpfr::ArenaBytes( size ); }
+
+inline void Construct( BigFloat* buffer, size_t size, void* arena )
 {
-    delete[] ptr;
-    ptr = nullptr;
+    if( arena == nullptr )
+        Construct<BigFloat>( buffer, size, arena );
+    else
+        mpfr::ConstructInArena( buffer, size, arena );
+}
+#endif
+
+template<typename G,typename=EnableIf<IsPacked<G>>>
+void Destruct( G* buffer, size_t size ) { }
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+void Destruct( G* buffer, size_t size )
+{
+    for( size_t i=0; i<size; ++i )
+        buffer[i].~G();
 }
 
 } // anonymous namespace
 
 template<typename G>
 Memory<G>::Memory()
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawSize_(0), rawBuffer_(nullptr), buffer_(nullptr)
 { }
 
 template<typename G>
 Memory<G>::Memory( size_t size )
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawSize_(0), rawBuffer_(nullptr), buffer_(nullptr)
 { Require( size ); }
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawSize_(0), rawBuffer_(nullptr), buffer_(nullptr)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -49,6 +82,7 @@ template<typename G>
 void Memory<G>::ShallowSwap( Memory<G>& mem )
 {
     std::swap(size_,mem.size_);
+    std::swap(rawSize_,mem.rawSize_);
     std::swap(rawBuffer_,mem.rawBuffer_);
     std::swap(buffer_,mem.buffer_);
 }
@@ -56,7 +90,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Empty();
 }
 
 template<typename G>
@@ -70,15 +104,30 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Empty();
 
 #ifndef EL_RELEASE
         try {
 #endif
-
-            // TODO: Optionally overallocate to force alignment of buffer_
-            rawBuffer_ = New<G>( size );
-            buffer_ = rawBuffer_;
+            const size_t alignment = Max( MemoryAlignment(), alignof(G) );
+            const size_t arenaBytes = ArenaBytes<G>( size );
+            const size_t numBytes = size*sizeof(G) + arenaBytes;
+            rawBuffer_ = memory::Allocate
+              ( numBytes, alignment, rawSize_, memory::Stats<G>() );
+            buffer_ = static_cast<G*>(rawBuffer_);
+            try
+            {
+                Construct
+                ( buffer_, size, arenaBytes==0 ? nullptr : buffer_+size );
+            }
+            catch( ... )
+            {
+                memory::Free( rawBuffer_, rawSize_, memory::Stats<G>() );
+                rawBuffer_ = nullptr;
+                rawSize_ = 0;
+                buffer_ = nullptr;
+                throw;
+            }
 
             size_ = size;
 #ifndef EL_RELEASE
@@ -110,7 +159,13 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    if( rawBuffer_ != nullptr )
+    {
+        Destruct( buffer_, size_ );
+        memory::Free( rawBuffer_, rawSize_, memory::Stats<G>() );
+    }
+    rawBuffer_ = nullptr;
+    rawSize_ = 0;
     buffer_ = nullptr;
     size_ = 0;
 }
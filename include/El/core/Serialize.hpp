@@ -117,6 +117,14 @@ void Deserialize
 
 #endif // ifdef EL_HAVE_MPC
 
+// The number of bytes occupied by each entry of type T within a packed
+// communication buffer (the arbitrary-precision types are sized using the
+// current default precision)
+template<typename T,typename=EnableIf<IsPacked<T>>>
+size_t SerializedSize() { return sizeof(T); }
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+size_t SerializedSize() { return T().SerializedSize(); }
+
 } // namespace El
 
 #endif // ifndef EL_SERIALIZE_HPP
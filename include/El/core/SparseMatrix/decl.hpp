@@ -24,6 +24,80 @@ namespace El {
 // Forward declaration for constructor
 template<typename T> class DistSparseMatrix;
 
+namespace SparseLayoutNS {
+enum SparseLayout {
+  SPARSE_CSR,
+  // Block CSR with dense blockSize x blockSize blocks
+  SPARSE_BCSR,
+  // Sliced ELLPACK (SELL-C-sigma)
+  SPARSE_SELL
+};
+}
+using namespace SparseLayoutNS;
+
+// The chunk size of SELL-C-sigma for which each chunk spans (roughly) a cache
+// line of values of each column, or zero if the datatype is too large for
+// any of the supported chunk sizes (4, 8, and 16)
+template<typename T>
+constexpr Int SELLChunkSize()
+{
+    return sizeof(T) > 16 ? 0 :
+         ( sizeof(T) >  8 ? 4 :
+         ( sizeof(T) >  4 ? 8 : 16 ) );
+}
+
+// The structure of a sparse matrix with frozen sparsity in a layout which is
+// better suited to repeated matrix-vector products than the CSR format. Block
+// CSR is used if the nonzeros cluster into aligned dense blocks so that fewer
+// column indices need to be read, and SELL-C-sigma is used otherwise: the
+// rows are sorted by their number of nonzeros within windows of sigma rows,
+// and each chunk of C consecutive sorted rows is padded to its longest row
+// and stored column-by-column so that products vectorize over the chunk.
+// The explicit zeros of both layouts are masked out of the products so that
+// they never multiply an infinite or NaN entry of x.
+template<typename T>
+struct SparseMultMeta
+{
+    bool ready;
+    SparseLayout layout;
+
+    // The block size of BCSR or the chunk size (C) of SELL-C-sigma
+    Int blockSize;
+    // The block row offsets of BCSR or the chunk offsets of SELL-C-sigma
+    vector<Int> offsets;
+    // The block column indices of BCSR or the (padded) column indices of
+    // SELL-C-sigma
+    vector<Int> colIndices;
+    // The original row of each sorted row of SELL-C-sigma
+    vector<Int> rowPerm;
+    // The number of stored entries of each sorted row of SELL-C-sigma, with
+    // zeros for the rows past the end of the last chunk
+    vector<Int> rowLengths;
+    // Bit r*blockSize+c of the mask of a BCSR block is set if entry (r,c) of
+    // the block is stored in the CSR format
+    vector<unsigned> blockMasks;
+    // The CSR offset of the first entry of each row of each BCSR block, or of
+    // each sorted row of SELL-C-sigma. Only the structure is copied, and the
+    // values are read from the CSR format by each product.
+    vector<Int> sources;
+
+    SparseMultMeta()
+    : ready(false), layout(SPARSE_CSR), blockSize(1) { }
+
+    void Clear()
+    {
+        ready = false;
+        layout = SPARSE_CSR;
+        blockSize = 1;
+        SwapClear( offsets );
+        SwapClear( colIndices );
+        SwapClear( rowPerm );
+        SwapClear( rowLengths );
+        SwapClear( blockMasks );
+        SwapClear( sources );
+    }
+};
+
 template<typename T>
 class SparseMatrix
 {
@@ -136,9 +210,30 @@ public:
 
     void AssertConsistent() const;
 
+    // Return the optimized index structure of a matrix with frozen sparsity,
+    // building it if necessary. Concurrent calls on the same matrix are
+    // serialized.
+    const SparseMultMeta<T>& InitializeMultMeta() const;
+
+    // Override the heuristic choice of the layout used for products with
+    // frozen sparsity. SPARSE_BCSR requires a block size of 2, 3, or 4 which
+    // divides both dimensions, SPARSE_SELL requires a datatype of at most 16
+    // bytes, and SPARSE_CSR disables the conversion.
+    void SetMultLayout( SparseLayout layout, Int blockSize=0 );
+    void ClearMultLayout();
+
 private:
     El::Graph graph_;
     vector<T> vals_;
+    mutable SparseMultMeta<T> multMeta_;
+    mutable std::mutex multMetaMutex_;
+
+    bool forceMultLayout_=false;
+    SparseLayout forcedMultLayout_=SPARSE_CSR;
+    Int forcedMultBlockSize_=0;
+
+    void FormBCSR( Int blockSize ) const;
+    void FormSELL( bool force=false ) const;
 
     struct CompareEntriesFunctor
     {
@@ -68,6 +68,7 @@ void SparseMatrix<T>::Empty( bool clearMemory )
         SwapClear( vals_ );
     else
         vals_.resize( 0 );
+    multMeta_.Clear();
 }
 
 template<typename T>
@@ -78,6 +79,7 @@ void SparseMatrix<T>::Resize( Int height, Int width )
         return;
     graph_.Resize( height, width );
     vals_.resize( 0 );
+    multMeta_.ready = false;
 }
 
 // Assembly
@@ -92,10 +94,16 @@ void SparseMatrix<T>::Reserve( Int numEntries )
 
 template<typename T>
 void SparseMatrix<T>::FreezeSparsity() EL_NO_EXCEPT
-{ graph_.frozenSparsity_ = true; }
+{
+    graph_.frozenSparsity_ = true;
+    multMeta_.ready = false;
+}
 template<typename T>
 void SparseMatrix<T>::UnfreezeSparsity() EL_NO_EXCEPT
-{ graph_.frozenSparsity_ = false; }
+{
+    graph_.frozenSparsity_ = false;
+    multMeta_.ready = false;
+}
 template<typename T>
 bool SparseMatrix<T>::FrozenSparsity() const EL_NO_EXCEPT
 { return graph_.frozenSparsity_; }
@@ -169,6 +177,10 @@ const SparseMatrix<T>& SparseMatrix<T>::operator=( const SparseMatrix<T>& A )
     DEBUG_CSE
     graph_ = A.graph_;
     vals_ = A.vals_;
+    forceMultLayout_ = A.forceMultLayout_;
+    forcedMultLayout_ = A.forcedMultLayout_;
+    forcedMultBlockSize_ = A.forcedMultBlockSize_;
+    multMeta_.ready = false;
     return *this;
 }
 
@@ -184,6 +196,7 @@ SparseMatrix<T>::operator=( const DistSparseMatrix<T>& A )
 
     graph_ = A.distGraph_;
     vals_ = A.vals_;
+    multMeta_.ready = false;
     return *this;
 }
 
@@ -289,7 +302,10 @@ bool SparseMatrix<T>::Consistent() const EL_NO_EXCEPT
 
 template<typename T>
 El::Graph& SparseMatrix<T>::Graph() EL_NO_EXCEPT
-{ return graph_; }
+{
+    multMeta_.ready = false;
+    return graph_;
+}
 template<typename T>
 const El::Graph& SparseMatrix<T>::LockedGraph() const EL_NO_EXCEPT
 { return graph_; }
@@ -373,13 +389,22 @@ void SparseMatrix<T>::Set( Int row, Int col, T val) EL_NO_RELEASE_EXCEPT
 
 template<typename T>
 Int* SparseMatrix<T>::SourceBuffer() EL_NO_EXCEPT
-{ return graph_.SourceBuffer(); }
+{
+    multMeta_.ready = false;
+    return graph_.SourceBuffer();
+}
 template<typename T>
 Int* SparseMatrix<T>::TargetBuffer() EL_NO_EXCEPT
-{ return graph_.TargetBuffer(); }
+{
+    multMeta_.ready = false;
+    return graph_.TargetBuffer();
+}
 template<typename T>
 Int* SparseMatrix<T>::OffsetBuffer() EL_NO_EXCEPT
-{ return graph_.OffsetBuffer(); }
+{
+    multMeta_.ready = false;
+    return graph_.OffsetBuffer();
+}
 template<typename T>
 T* SparseMatrix<T>::ValueBuffer() EL_NO_EXCEPT
 { return vals_.data(); }
@@ -403,11 +428,15 @@ void SparseMatrix<T>::ForceNumEntries( Int numEntries )
     DEBUG_CSE
     graph_.ForceNumEdges( numEntries );
     vals_.resize( numEntries );
+    multMeta_.ready = false;
 }
 
 template<typename T>
 void SparseMatrix<T>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
-{ graph_.ForceConsistency( consistent ); }
+{
+    graph_.ForceConsistency( consistent );
+    multMeta_.ready = false;
+}
 
 // Auxiliary routines
 // ==================
@@ -421,6 +450,7 @@ void SparseMatrix<T>::ProcessQueues()
           graph_.targets_.size() != vals_.size() )
           LogicError("Inconsistent sparse matrix buffer sizes");
     )
+    multMeta_.ready = false;
     if( graph_.consistent_ )
         return;
 
@@ -488,6 +518,250 @@ template<typename T>
 void SparseMatrix<T>::AssertConsistent() const
 { graph_.AssertConsistent(); }
 
+template<typename T>
+void SparseMatrix<T>::SetMultLayout( SparseLayout layout, Int blockSize )
+{
+    DEBUG_CSE
+    if( layout == SPARSE_BCSR && (blockSize < 2 || blockSize > 4) )
+        LogicError("BCSR block size must be 2, 3, or 4");
+    if( layout == SPARSE_SELL && SELLChunkSize<T>() == 0 )
+        LogicError("SELL-C-sigma is not supported for ",TypeName<T>());
+    forceMultLayout_ = true;
+    forcedMultLayout_ = layout;
+    forcedMultBlockSize_ = blockSize;
+    multMeta_.ready = false;
+}
+
+template<typename T>
+void SparseMatrix<T>::ClearMultLayout()
+{
+    forceMultLayout_ = false;
+    multMeta_.ready = false;
+}
+
+template<typename T>
+const SparseMultMeta<T>& SparseMatrix<T>::InitializeMultMeta() const
+{
+    DEBUG_CSE
+    std::lock_guard<std::mutex> guard( multMetaMutex_ );
+    if( multMeta_.ready )
+        return multMeta_;
+    AssertConsistent();
+    multMeta_.Clear();
+    multMeta_.ready = true;
+    if( !FrozenSparsity() || NumEntries() == 0 )
+        return multMeta_;
+    if( forceMultLayout_ )
+    {
+        if( forcedMultLayout_ == SPARSE_BCSR )
+        {
+            if( Height() % forcedMultBlockSize_ != 0 ||
+                Width() % forcedMultBlockSize_ != 0 )
+                LogicError
+                ("BCSR block size of ",forcedMultBlockSize_,
+                 " does not divide the ",Height()," x ",Width()," matrix");
+            FormBCSR( forcedMultBlockSize_ );
+        }
+        else if( forcedMultLayout_ == SPARSE_SELL )
+            FormSELL( true );
+        return multMeta_;
+    }
+    // Only the real BLAS datatypes were found to benefit, as the products
+    // of the complex datatypes are too expensive to be bound by the memory
+    // traffic
+    if( !IsBlasScalar<T>::value || IsComplex<T>::value )
+        return multMeta_;
+
+    // Prefer BCSR if it would stream at most 80% of the bytes of CSR
+    const Int m = Height();
+    const Int n = Width();
+    const Int numEntries = NumEntries();
+    const Int* offsetBuf = LockedOffsetBuffer();
+    const Int* targetBuf = LockedTargetBuffer();
+    const double csrBytes =
+      double(numEntries)*(sizeof(T)+sizeof(Int)) + double(m+1)*sizeof(Int);
+    double bestBytes = 0.8*csrBytes;
+    Int bestBlockSize = 1;
+    vector<Int> lastBlockRow;
+    for( Int blockSize : {2,3,4} )
+    {
+        if( m % blockSize != 0 || n % blockSize != 0 )
+            continue;
+        const Int numBlockRows = m / blockSize;
+        lastBlockRow.assign( n/blockSize, -1 );
+        Int numBlocks = 0;
+        for( Int iBlock=0; iBlock<numBlockRows; ++iBlock )
+        {
+            const Int eStart = offsetBuf[iBlock*blockSize];
+            const Int eStop = offsetBuf[(iBlock+1)*blockSize];
+            for( Int e=eStart; e<eStop; ++e )
+            {
+                const Int jBlock = targetBuf[e] / blockSize;
+                if( lastBlockRow[jBlock] != iBlock )
+                {
+                    lastBlockRow[jBlock] = iBlock;
+                    ++numBlocks;
+                }
+            }
+        }
+        const double bcsrBytes =
+          double(numBlocks)*(blockSize*blockSize*sizeof(T)+sizeof(Int)) +
+          double(numBlockRows+1)*sizeof(Int);
+        if( bcsrBytes <= bestBytes )
+        {
+            bestBytes = bcsrBytes;
+            bestBlockSize = blockSize;
+        }
+    }
+    if( bestBlockSize > 1 )
+        FormBCSR( bestBlockSize );
+    else if( SELLChunkSize<T>() != 0 )
+        FormSELL();
+    return multMeta_;
+}
+
+template<typename T>
+void SparseMatrix<T>::FormBCSR( Int blockSize ) const
+{
+    DEBUG_CSE
+    const Int numBlockRows = Height() / blockSize;
+    const Int numBlockCols = Width() / blockSize;
+    const Int* offsetBuf = LockedOffsetBuffer();
+    const Int* targetBuf = LockedTargetBuffer();
+    auto& meta = multMeta_;
+    meta.layout = SPARSE_BCSR;
+    meta.blockSize = blockSize;
+    meta.offsets.resize( numBlockRows+1 );
+
+    // blockIndex[jBlock] is the index of the block in column jBlock of the
+    // current block row
+    vector<Int> blockIndex( numBlockCols, -1 );
+    meta.offsets[0] = 0;
+    for( Int iBlock=0; iBlock<numBlockRows; ++iBlock )
+    {
+        const Int eStart = offsetBuf[iBlock*blockSize];
+        const Int eStop = offsetBuf[(iBlock+1)*blockSize];
+        const Int rowStart = meta.colIndices.size();
+        for( Int e=eStart; e<eStop; ++e )
+        {
+            const Int jBlock = targetBuf[e] / blockSize;
+            if( blockIndex[jBlock] < rowStart )
+            {
+                blockIndex[jBlock] = meta.colIndices.size();
+                meta.colIndices.push_back( jBlock );
+            }
+        }
+        std::sort( meta.colIndices.begin()+rowStart, meta.colIndices.end() );
+        const Int rowStop = meta.colIndices.size();
+        for( Int index=rowStart; index<rowStop; ++index )
+            blockIndex[meta.colIndices[index]] = index;
+        meta.offsets[iBlock+1] = rowStop;
+    }
+
+    // Since the columns of each row are sorted, the entries of each row of
+    // a block are contiguous in the CSR format, and only the offset of the
+    // first (and the mask of the stored entries) need to be kept
+    const Int numBlocks = meta.colIndices.size();
+    meta.sources.assign( numBlocks*blockSize, 0 );
+    meta.blockMasks.assign( numBlocks, 0u );
+    for( Int iBlock=0; iBlock<numBlockRows; ++iBlock )
+    {
+        const Int blockStart = meta.offsets[iBlock];
+        const Int blockStop = meta.offsets[iBlock+1];
+        for( Int index=blockStart; index<blockStop; ++index )
+            blockIndex[meta.colIndices[index]] = index;
+        for( Int i=iBlock*blockSize; i<(iBlock+1)*blockSize; ++i )
+        {
+            const Int iOff = i - iBlock*blockSize;
+            for( Int e=offsetBuf[i+1]-1; e>=offsetBuf[i]; --e )
+            {
+                const Int j = targetBuf[e];
+                const Int index = blockIndex[j/blockSize];
+                meta.sources[index*blockSize+iOff] = e;
+                meta.blockMasks[index] |= 1u << (iOff*blockSize+j%blockSize);
+            }
+        }
+    }
+}
+
+template<typename T>
+void SparseMatrix<T>::FormSELL( bool force ) const
+{
+    DEBUG_CSE
+    const Int m = Height();
+    const Int numEntries = NumEntries();
+    const Int* offsetBuf = LockedOffsetBuffer();
+    const Int* targetBuf = LockedTargetBuffer();
+
+    // The rows are sorted within windows of sigma rows so that the rows of
+    // each chunk have similar lengths without destroying the locality of the
+    // accesses to x
+    const Int chunkSize = SELLChunkSize<T>();
+    const Int sigma = 256;
+    const Int numChunks = (m+chunkSize-1) / chunkSize;
+
+    auto& meta = multMeta_;
+    meta.rowPerm.resize( m );
+    for( Int i=0; i<m; ++i )
+        meta.rowPerm[i] = i;
+    auto longerRow =
+      [&]( Int i0, Int i1 )
+      { return offsetBuf[i0+1]-offsetBuf[i0] > offsetBuf[i1+1]-offsetBuf[i1]; };
+    for( Int iBeg=0; iBeg<m; iBeg+=sigma )
+        std::stable_sort
+        ( meta.rowPerm.begin()+iBeg, meta.rowPerm.begin()+Min(iBeg+sigma,m),
+          longerRow );
+
+    meta.offsets.resize( numChunks+1 );
+    meta.offsets[0] = 0;
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        // The rows are sorted in decreasing length within each window
+        const Int i = meta.rowPerm[chunk*chunkSize];
+        const Int width = offsetBuf[i+1] - offsetBuf[i];
+        meta.offsets[chunk+1] = meta.offsets[chunk] + width*chunkSize;
+    }
+    const Int numStored = meta.offsets[numChunks];
+    if( !force && 2*numStored > 3*numEntries )
+    {
+        // The padding would outweigh the benefits of vectorization
+        meta.Clear();
+        meta.ready = true;
+        return;
+    }
+    meta.layout = SPARSE_SELL;
+    meta.blockSize = chunkSize;
+
+    // The column indices of each chunk are stored column-by-column, where
+    // the padding points to the first column in order to keep the accesses
+    // to x in bounds (its products are masked out using the row lengths).
+    // The values are read from the CSR format, where each row is contiguous.
+    meta.colIndices.assign( numStored, 0 );
+    meta.sources.assign( numChunks*chunkSize, 0 );
+    meta.rowLengths.assign( numChunks*chunkSize, 0 );
+    for( Int iSort=0; iSort<m; ++iSort )
+    {
+        const Int i = meta.rowPerm[iSort];
+        meta.sources[iSort] = offsetBuf[i];
+        meta.rowLengths[iSort] = offsetBuf[i+1] - offsetBuf[i];
+    }
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int chunkOff = meta.offsets[chunk];
+        const Int rowStop = Min( (chunk+1)*chunkSize, m );
+        for( Int iSort=chunk*chunkSize; iSort<rowStop; ++iSort )
+        {
+            const Int i = meta.rowPerm[iSort];
+            const Int iOff = iSort - chunk*chunkSize;
+            for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+            {
+                const Int index = chunkOff + (e-offsetBuf[i])*chunkSize + iOff;
+                meta.colIndices[index] = targetBuf[e];
+            }
+        }
+    }
+}
+
 #ifdef EL_INSTANTIATE_CORE
 # define EL_EXTERN
 #else
@@ -85,6 +85,9 @@ void ProcessInput();
 void PrintInputReport();
 
 // For getting and setting the algorithmic blocksize
+// NOTE: Each thread has its own blocksize stack, and threads which have not
+//       pushed onto theirs fall back to the default blocksize (but must push
+//       before calling SetBlocksize)
 Int Blocksize();
 void SetBlocksize( Int blocksize );
 
@@ -93,6 +96,46 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// For getting and setting the blocksize of a particular routine and datatype.
+// The calling thread's explicit setting takes precedence, followed by the
+// autotuned value for the problem shape (if one was provided), and finally
+// 'defaultBlocksize'.
+template<typename T>
+Int Blocksize( const string& routine, Int defaultBlocksize=Blocksize() );
+template<typename T>
+void SetBlocksize( const string& routine, Int blocksize );
+template<typename T>
+void ClearBlocksize( const string& routine );
+
+// Also consult the autotuned blocksizes for the given problem shape (without
+// ever running a trial)
+template<typename T>
+Int Blocksize
+( const string& routine, Int m, Int n, Int defaultBlocksize=Blocksize() );
+
+// If autotuning is enabled and no blocksize has been cached for the given
+// routine, datatype, and (power-of-two rounded) problem shape, 'trial' is
+// timed for each candidate blocksize and the fastest is cached for all
+// threads. 'trial' should perform the operation on a scratch copy.
+// NOTE: The timings are local to each process, so routines which are run
+//       redundantly by several processes should choose the blocksize on one
+//       process and broadcast it (as is done for Cholesky of [STAR,STAR]
+//       matrices) so that the processes compute the same result.
+template<typename T>
+Int Blocksize
+( const string& routine, Int m, Int n,
+  function<void(Int)> trial, Int defaultBlocksize=Blocksize() );
+
+void SetBlocksizeTuning( bool tune );
+bool BlocksizeTuning();
+void SetBlocksizeCandidates( const vector<Int>& candidates );
+vector<Int> BlocksizeCandidates();
+
+// For reusing autotuned blocksizes across runs
+void SaveTunedBlocksizes( const string& filename );
+void LoadTunedBlocksizes( const string& filename );
+void ClearTunedBlocksizes();
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -575,6 +575,29 @@ void Gemm
   const T& beta,
         T* C, BlasInt CLDim );
 
+// The unblocked triple loop which Gemm falls back to for matrix-vector-like
+// products of datatypes not supported by BLAS
+template<typename T>
+void NaiveGemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim, 
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim );
+
+// The packed (GotoBLAS-style) implementation which Gemm uses for all other
+// products of datatypes not supported by BLAS. Both it and NaiveGemm are also
+// instantiated for the BLAS datatypes so that they can be tested against BLAS.
+template<typename T>
+void PackedGemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim, 
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim );
+
 void Gemm
 ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
   const float& alpha,
@@ -32,6 +32,11 @@ void Copy
 void Copy
 ( char uplo, BlasInt m, BlasInt n, 
   const dcomplex* A, BlasInt lda, dcomplex* B, BlasInt ldb );
+#ifdef EL_HAVE_MPC
+void Copy
+( char uplo, BlasInt m, BlasInt n,
+  const BigFloat* A, BlasInt lda, BigFloat* B, BlasInt ldb );
+#endif
 template<typename T>
 void Copy
 ( char uplo, BlasInt m, BlasInt n, 
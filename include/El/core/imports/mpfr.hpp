@@ -37,6 +37,25 @@ void FreeMPI();
 
 mpfr_rnd_t RoundingMode();
 
+// When arena mode is enabled, the entries of each Memory<BigFloat> buffer
+// (and hence of each Matrix<BigFloat>) share a single slab for their limbs
+// rather than each requesting its own allocation from MPFR
+void SetArenaMode( bool arenaMode );
+bool ArenaMode();
+
+// The number of bytes of limb storage required for 'size' entries of the
+// default precision, or zero if arena mode is disabled
+size_t ArenaBytes( size_t size );
+
+// Construct 'size' entries of the default precision in 'buffer' whose limbs
+// are stored contiguously within 'arena' (of at least ArenaBytes(size) bytes)
+void ConstructInArena( BigFloat* buffer, size_t size, void* arena );
+
+// If the 'size' entries of both 'x' and 'y' are arena-backed with a common
+// precision and contiguous limbs, copy x into y with a single memcpy of the
+// limbs and return true; otherwise, leave y untouched and return false
+bool CopyArenaRun( size_t size, const BigFloat* x, BigFloat* y );
+
 } // namespace mpfr
 
 namespace mpc {
@@ -321,6 +340,9 @@ class BigFloat {
 private:
     mpfr_t mpfrFloat_;
     size_t numLimbs_;
+    // Whether the limbs live in externally-managed storage (e.g., the slab
+    // of a Memory<BigFloat> in arena mode) rather than being owned by MPFR
+    bool inArena_=false;
 
     void SetNumLimbs( mpfr_prec_t prec );
     void Init( mpfr_prec_t prec=mpfr::Precision() );
@@ -333,6 +355,7 @@ public:
     mpfr_prec_t Precision() const;
     void        SetPrecision( mpfr_prec_t );
     size_t      NumLimbs() const;
+    bool        InArena() const;
 
     // NOTE: The default constructor does not take an mpfr_prec_t as input
     //       due to the ambiguity is would cause with respect to the
@@ -360,6 +383,9 @@ public:
     BigFloat
     ( const std::string& str, int base, mpfr_prec_t prec=mpfr::Precision() );
     BigFloat( BigFloat&& a );
+    // Initialize as NaN using the mpfr_custom_get_size(prec) bytes starting
+    // at 'limbs', which must outlive this object
+    BigFloat( mp_limb_t* limbs, mpfr_prec_t prec );
     ~BigFloat();
 
     void Zero();
@@ -14,6 +14,7 @@ namespace El {
 
 using std::function;
 using std::vector;
+using std::shared_ptr;
 
 namespace mpi {
 
@@ -665,6 +666,25 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+// NOTE: If MPI-3 non-blocking collectives are unavailable, or the datatype
+//       requires serialization, a blocking AllGather is performed and the
+//       request is trivially complete
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -1096,6 +1116,59 @@ void SparseAllToAll
   const vector<int>& recvOffs,
         Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// A plan for repeatedly exchanging data with a (typically small) set of
+// neighboring processes. Only the counts and offsets of the neighbors are
+// stored, which avoids the O(p) metadata and latency of AllToAll. If MPI-3
+// neighborhood collectives are available, the plan forms a distributed graph
+// communicator over the neighbors the second time that it is used, so that
+// plans which are only used once never pay for its (collective) creation.
+//
+// NOTE: The graph communicator is owned by the plan and is never shared with
+//       copies, which instead fall back to point-to-point exchanges. Clearing
+//       or destroying a plan which holds a graph communicator is collective.
+struct NeighborPlan
+{
+    vector<int> sendRanks, sendCounts, sendOffs;
+    vector<int> recvRanks, recvCounts, recvOffs;
+    // The (optional) distributed graph communicator over the neighbors
+    Comm graphComm;
+
+    NeighborPlan();
+    NeighborPlan( const NeighborPlan& plan );
+    ~NeighborPlan();
+
+    const NeighborPlan& operator=( const NeighborPlan& plan );
+
+    void Clear();
+};
+
+// Form a plan from the (length p) counts and offsets of an AllToAll by only
+// keeping the processes with nonzero counts. If 'formGraphComm' is true
+// (and neighborhood collectives are available), the graph communicator is
+// formed, which is collective over 'comm' and only worthwhile if the plan
+// will be reused. Since copies of a plan do not share its graph
+// communicator, they exchange using point-to-point messages.
+void BuildNeighborPlan
+( const vector<int>& sendCounts, const vector<int>& sendOffs,
+  const vector<int>& recvCounts, const vector<int>& recvOffs,
+  NeighborPlan& plan, Comm comm,
+  bool includeSelf=true, bool formGraphComm=true );
+
+// Exchange width values for each of the indices in the plan, where the
+// offsets of the plan are scaled by the width
+template<typename T>
+void NeighborAllToAll
+( const T* sendBuf, T* recvBuf, int width,
+  const NeighborPlan& plan, Comm comm );
+
+// The nonblocking analogue of NeighborAllToAll, where the buffers may not be
+// used until the returned requests have been waited upon
+template<typename T>
+void INeighborAllToAll
+( const T* sendBuf, T* recvBuf, int width,
+  const NeighborPlan& plan, Comm comm,
+  vector<Request<T>>& requests );
+
 void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm );
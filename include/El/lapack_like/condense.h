@@ -108,7 +108,8 @@ EL_EXPORT ElError ElApplyPAfterBidiagDist_z
 typedef enum {
   EL_HERMITIAN_TRIDIAG_NORMAL,
   EL_HERMITIAN_TRIDIAG_SQUARE,
-  EL_HERMITIAN_TRIDIAG_DEFAULT
+  EL_HERMITIAN_TRIDIAG_DEFAULT,
+  EL_HERMITIAN_TRIDIAG_TWO_STAGE
 } ElHermitianTridiagApproach;
 
 typedef struct {
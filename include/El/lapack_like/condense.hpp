@@ -96,7 +96,8 @@ enum HermitianTridiagApproach
 {
     HERMITIAN_TRIDIAG_NORMAL, // Keep the current grid
     HERMITIAN_TRIDIAG_SQUARE, // Drop to a square process grid
-    HERMITIAN_TRIDIAG_DEFAULT // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_DEFAULT, // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_TWO_STAGE // Reduce to a band, then chase the bulges
 };
 }
 using namespace HermitianTridiagApproachNS;
@@ -107,6 +108,16 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<F> symvCtrl;
+
+    // The intermediate bandwidth of the two-stage approach
+    // (a value of zero defaults to the algorithmic blocksize)
+    Int bandwidth=0;
+
+    // The maximum number of entries of the bulge-chasing reflectors (about
+    // n^2/2) which the distributed two-stage approach may redundantly store
+    // on each process. Larger problems whose reflectors are needed fall back
+    // to the one-stage approach.
+    Int maxRedundantEntries=Int(1)<<27;
 };
 
 template<typename F>
@@ -122,7 +133,9 @@ void HermitianTridiag
 namespace herm_tridiag {
 
 template<typename F>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A );
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
 template<typename F>
 void ExplicitCondensed
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A,
@@ -141,6 +154,60 @@ void ApplyQ
   const AbstractDistMatrix<F>& householderScalars, 
         AbstractDistMatrix<F>& B );
 
+// The two-stage approach first reduces A to a band of width b using level-3
+// updates and then chases the bulges down to tridiagonal form. The first set
+// of reflectors is stored, as usual, in the portion of A below the band,
+// whereas the (redundantly stored) reflectors generated while chasing are
+// returned separately, as each one overlaps the band.
+template<typename F>
+struct TwoStageData
+{
+    Int bandwidth=0;
+
+    // The scalars for the reflectors packed below the b'th subdiagonal of A
+    Matrix<F> householderScalars1;
+
+    // Column j of 'V2' holds the j'th bulge-chasing reflector, which acts on
+    // the indices [offsets2[j],offsets2[j]+b) (truncated to the matrix).
+    // They are only needed to apply Q and are not stored if
+    // 'storeReflectors' is false.
+    bool storeReflectors=true;
+    Matrix<F> V2;
+    Matrix<F> householderScalars2;
+    vector<Int> offsets2;
+
+    // Set if the distributed reduction instead used the one-stage approach
+    // (see HermitianTridiagCtrl::maxRedundantEntries), in which case the
+    // bandwidth is one and there are no bulge-chasing reflectors
+    bool oneStage=false;
+};
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  TwoStageData<F>& data,
+  const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  TwoStageData<F>& data,
+  const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const Matrix<F>& A,
+  const TwoStageData<F>& data,
+        Matrix<F>& B );
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const TwoStageData<F>& data,
+        AbstractDistMatrix<F>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -459,7 +459,8 @@ typedef enum
   EL_LU_PARTIAL,
   EL_LU_FULL,
   EL_LU_ROOK,
-  EL_LU_WITHOUT_PIVOTING
+  EL_LU_WITHOUT_PIVOTING,
+  EL_LU_TOURNAMENT
 } ElLUPivotType;
 
 /* LU factorization with no pivoting
@@ -162,17 +162,22 @@ void LDL
   const LDLPivotCtrl<Base<F>>& ctrl=LDLPivotCtrl<Base<F>>() );
 
 // All fronts of L are required to be initialized to the expansions of the
-// original sparse matrix before calling LDL.
+// original sparse matrix before calling LDL. The BLR control only affects
+// the LDL_BLR_1D and LDL_BLR_2D front types, which compress the sequential
+// fronts (including the duplicates at the leaves of the distributed tree)
+// and leave the fronts shared by several processes dense.
 template<typename F>
 void LDL
 ( const ldl::NodeInfo& info,
         ldl::Front<F>& L,
-  LDLFrontType newType=LDL_2D );
+  LDLFrontType newType=LDL_2D,
+  const ldl::BLRCtrl<Base<F>>& blrCtrl=ldl::BLRCtrl<Base<F>>() );
 template<typename F>
 void LDL
 ( const ldl::DistNodeInfo& info,
         ldl::DistFront<F>& L,
-  LDLFrontType newType=LDL_2D );
+  LDLFrontType newType=LDL_2D,
+  const ldl::BLRCtrl<Base<F>>& blrCtrl=ldl::BLRCtrl<Base<F>>() );
 
 namespace ldl {
 
@@ -459,16 +464,18 @@ Int SolveAfter
 // LU
 // ==
 
-// NOTE: This is not yet made use of, but the fully-pivoted version of LU
-//       should (soon?) accept it as an argument and potentially return one or
-//       more of the permutation matrices as the identity
+// NOTE: This is so far only accepted by the row-pivoted versions of LU, but
+//       the fully-pivoted version should (soon?) accept it as an argument and
+//       potentially return one or more of the permutation matrices as the
+//       identity
 namespace LUPivotTypeNS {
 enum LUPivotType
 {
     LU_PARTIAL,
     LU_FULL,
     LU_ROOK, /* not yet supported */
-    LU_WITHOUT_PIVOTING
+    LU_WITHOUT_PIVOTING,
+    LU_TOURNAMENT
 };
 }
 using namespace LUPivotTypeNS;
@@ -489,6 +496,21 @@ void LU( Matrix<F>& A, Permutation& P );
 template<typename F>
 void LU( AbstractDistMatrix<F>& A, DistPermutation& P );
 
+// LU with row pivoting
+// --------------------
+// The supported pivot types are LU_PARTIAL, LU_WITHOUT_PIVOTING (where P is
+// returned as the identity), and LU_TOURNAMENT, which chooses all of the pivots
+// of each panel at once with a reduction tree of partially-pivoted LU
+// factorizations of the local rows (CALU) rather than with one reduction over
+// the process column per pivot.
+template<typename F>
+void LU( Matrix<F>& A, Permutation& P, LUPivotType pivotType );
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& A,
+  DistPermutation& P,
+  LUPivotType pivotType );
+
 // LU with full pivoting
 // ---------------------
 // P A Q^T = L U
@@ -524,6 +546,16 @@ void LUMod
 
 namespace lu {
 
+// Element growth of an LU factorization
+// -------------------------------------
+// Returns max_{i,j} |U(i,j)| / max_{i,j} |A(i,j)|, where the factorization
+// of A was computed in-place within LU
+template<typename F>
+Base<F> GrowthFactor( const Matrix<F>& A, const Matrix<F>& LU );
+template<typename F>
+Base<F> GrowthFactor
+( const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& LU );
+
 // Solve linear systems using an implicit unpivoted LU factorization
 // -----------------------------------------------------------------
 template<typename F>
@@ -651,11 +683,35 @@ void Explicit( AbstractDistMatrix<F>& L, AbstractDistMatrix<F>& A );
 // QR factorization
 // ================
 
+namespace TSQRTreeNS {
+enum TSQRTree
+{
+    TSQR_BINARY_TREE,
+    TSQR_FLAT_TREE,
+    // A flat tree within each group of 'groupSize' consecutive processes
+    // (e.g., those sharing a node) and a binary tree over the groups
+    TSQR_HYBRID_TREE
+};
+}
+using namespace TSQRTreeNS;
+
+struct TSQRCtrl
+{
+    TSQRTree tree=TSQR_BINARY_TREE;
+    Int groupSize=8;
+};
+
 template<typename Real>
 struct QRCtrl
 {
     bool colPiv=false;
 
+    // Factor each panel of an unpivoted distributed QR factorization with TSQR
+    // and reconstruct its Householder vectors (CAQR) rather than performing
+    // reductions over the process column for each Householder reflection
+    bool caqr=false;
+    TSQRCtrl tsqrCtrl;
+
     bool boundRank=false;
     Int maxRank=0;
 
@@ -664,6 +720,13 @@ struct QRCtrl
 
     bool alwaysRecomputeNorms=false;
 
+    // Choose each block of pivots by running Businger-Golub on a small
+    // Gaussian sketch (with 'oversample' more rows than the blocksize) of the
+    // trailing matrix rather than downdating the column norms after every
+    // reflection, so that the updates are performed with level-3 operations
+    bool randomized=false;
+    Int oversample=8;
+
     // Selecting for the smallest norm first is an important preprocessing
     // step for LLL suggested by Wubben et al.
     //
@@ -686,6 +749,16 @@ void QR
   AbstractDistMatrix<F>& householderScalars,
   AbstractDistMatrix<Base<F>>& signature );
 
+// Return an implicit representation of Q and R such that A = Q R, with the
+// panel factorizations chosen by ctrl.caqr
+// ------------------------------------------------------------------------
+template<typename F>
+void QR
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature,
+  const QRCtrl<Base<F>>& ctrl );
+
 // Return an implicit representation of (Q,R,Omega) such that A Omega^T ~= Q R
 // ---------------------------------------------------------------------------
 template<typename F>
@@ -824,6 +897,9 @@ void DisjointNeighborColSwaps
         Matrix<F>& R,
   const Matrix<Int>& colSwaps );
 
+// The factorizations computed by a process during TSQR: that of its local
+// rows, followed by those of each merge of its triangular factor with that of
+// one of its children in the reduction tree (in the order of the merges)
 template<typename F>
 struct TreeData
 {
@@ -832,6 +908,7 @@ struct TreeData
     vector<Matrix<F>> QRList;
     vector<Matrix<F>> householderScalarsList;
     vector<Matrix<Base<F>>> signatureList;
+    TSQRCtrl ctrl;
 
     TreeData( Int numStages=0 )
     : QRList(numStages),
@@ -845,7 +922,8 @@ struct TreeData
       signature0(move(treeData.signature0)),
       QRList(move(treeData.QRList)),
       householderScalarsList(move(treeData.householderScalarsList)),
-      signatureList(move(treeData.signatureList))
+      signatureList(move(treeData.signatureList)),
+      ctrl(treeData.ctrl)
     { }
 
     TreeData<F>& operator=( TreeData<F>&& treeData )
@@ -856,17 +934,22 @@ struct TreeData
         QRList = move(treeData.QRList);
         householderScalarsList = move(treeData.householderScalarsList);
         signatureList = move(treeData.signatureList);
+        ctrl = treeData.ctrl;
         return *this;
     }
 };
 
 // Return an implicit tall-skinny QR factorization
 template<typename F>
-TreeData<F> TS( const AbstractDistMatrix<F>& A );
+TreeData<F> TS
+( const AbstractDistMatrix<F>& A, const TSQRCtrl& ctrl=TSQRCtrl() );
 
 // Return an explicit tall-skinny QR factorization
 template<typename F>
-void ExplicitTS( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R );
+void ExplicitTS
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& R,
+  const TSQRCtrl& ctrl=TSQRCtrl() );
 
 namespace ts {
 
@@ -32,7 +32,8 @@ enum LDLFrontType
   LDL_INTRAPIV_1D,        LDL_INTRAPIV_2D,
   LDL_INTRAPIV_SELINV_1D, LDL_INTRAPIV_SELINV_2D,
   BLOCK_LDL_1D,           BLOCK_LDL_2D,
-  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D
+  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D,
+  LDL_BLR_1D,             LDL_BLR_2D
 };
 
 bool Unfactored( LDLFrontType type );
@@ -40,6 +41,7 @@ bool FrontIs1D( LDLFrontType type );
 bool BlockFactorization( LDLFrontType type );
 bool SelInvFactorization( LDLFrontType type );
 bool PivotedFactorization( LDLFrontType type );
+bool BLRFactorization( LDLFrontType type );
 LDLFrontType ConvertTo2D( LDLFrontType type );
 LDLFrontType ConvertTo1D( LDLFrontType type );
 LDLFrontType AppendSelInv( LDLFrontType type );
@@ -104,6 +106,7 @@ struct MultiVecCommMeta
 
 struct DistMultiVecNodeMeta
 {
+    bool ready;
     vector<Int> sendInds;
     vector<Int> recvInds;
     vector<int> mappedOwners;
@@ -111,6 +114,13 @@ struct DistMultiVecNodeMeta
     vector<int> sendOffs;
     vector<int> recvSizes;
     vector<int> recvOffs;
+    // Plans for exchanging the values with only the processes which share
+    // indices with this one, in the directions of Push and Pull. Their graph
+    // communicators are only formed if the metadata will be reused.
+    mpi::NeighborPlan pushPlan, pullPlan;
+    bool formGraphComms;
+
+    DistMultiVecNodeMeta() : ready(false), formGraphComms(true) { }
 
     template<typename T>
     void Initialize
@@ -218,6 +228,54 @@ struct DistMatrixNode
     void ComputeCommMeta( const DistNodeInfo& info ) const;
 };
 
+// Block low-rank (BLR) compression
+// ===============================
+// The bottom-left blocks of the sequential fronts of BLR factorizations are
+// split into tileSize x tileSize tiles, each of which is replaced by an
+// interpolative decomposition whenever its rank at the relative tolerance
+// makes the low-rank form smaller than the dense tile. The factorization is
+// then only approximate and is meant to be combined with iterative
+// refinement.
+template<typename Real>
+struct BLRCtrl
+{
+    Real relTol=Pow(limits::Epsilon<Real>(),Real(0.5));
+    Int tileSize=128;
+};
+
+template<typename F>
+struct BLRMatrix
+{
+    Int height=0, width=0, tileSize=0;
+
+    // Tile (I,J) is stored in entry I+J*NumTileRows() and is approximated as
+    // U V when V is nonempty; otherwise it is held densely within U.
+    vector<Matrix<F>> U, V;
+
+    Int NumTileRows() const
+    { return tileSize == 0 ? 0 : (height+tileSize-1)/tileSize; }
+    Int NumTileCols() const
+    { return tileSize == 0 ? 0 : (width+tileSize-1)/tileSize; }
+    bool LowRank( Int I, Int J ) const
+    { return V[I+J*NumTileRows()].Width() != 0; }
+
+    Int NumEntries() const;
+    void Empty();
+};
+
+template<typename F>
+void Compress
+( const Matrix<F>& A, BLRMatrix<F>& B, const BLRCtrl<Base<F>>& ctrl );
+template<typename F>
+void Decompress( const BLRMatrix<F>& B, Matrix<F>& A );
+
+// Y := alpha op(B) X + beta Y
+template<typename F>
+void Multiply
+( Orientation orientation,
+  F alpha, const BLRMatrix<F>& B, const Matrix<F>& X,
+  F beta,                               Matrix<F>& Y );
+
 // Only keep track of the left and bottom-right piece of the fronts
 // (with the bottom-right piece stored in workspace) since only the left side
 // needs to be kept after the factorization is complete.
@@ -234,6 +292,9 @@ struct Front
 
     Matrix<F> LDense;
     SparseMatrix<F> LSparse;
+    // The compressed bottom-left block of a BLR front, in which case LDense
+    // only holds the top-left block
+    BLRMatrix<F> LBLR;
 
     Matrix<F> diag;
     Matrix<F> subdiag;
@@ -242,6 +303,11 @@ struct Front
     Matrix<F> workDense;
     SparseMatrix<F> workSparse;
 
+    // The number of entries of update-matrix workspace predicted from the
+    // symbolic analysis and the number in use at the peak of the most recent
+    // factorization (only tracked by the root of the tree)
+    Int workPredicted, workPeak;
+
     Front<F>* parent;
     vector<Front<F>*> children;
     DistFront<F>* duplicate;
@@ -301,6 +367,43 @@ struct FactorCommMeta
 };
 void ComputeFactRecvInds( const DistNodeInfo& info );
 
+// The value-independent portion of pulling a DistSparseMatrix into a
+// DistFront tree. Once it is initialized (by the first pull), pulls of
+// matrices with the same sparsity pattern only exchange the nonzero values
+// and reuse the fronts (and their factorization communication metadata)
+// from the previous pull.
+struct DistFrontPullMeta
+{
+    bool initialized=false;
+
+    // The reordered indices of the local rows and columns of the matrix
+    vector<Int> mappedSources, mappedTargets, colOffs;
+
+    // The number of rows received from each process, the number of nonzeros
+    // within each of these rows, and the reordered targets of the nonzeros
+    vector<int> rowSizes, rowOffs;
+    vector<Int> rowLengths;
+    vector<Int> targets;
+    vector<int> recvSizes, recvOffs;
+
+    // The indices of the local nonzeros to send to each process
+    vector<Int> sendInds;
+    vector<int> sendSizes, sendOffs;
+
+    // The seconds spent by the last pull forming the metadata (which is
+    // negligible if it was reused) and exchanging and unpacking the values
+    double metaTime=0, valueTime=0;
+
+    template<typename F>
+    void Initialize
+    ( const DistSparseMatrix<F>& A,
+      const DistMap& reordering,
+      const DistSeparator& rootSep,
+      const DistNodeInfo& rootInfo );
+
+    void Empty();
+};
+
 template<typename F>
 struct DistFront
 {
@@ -311,7 +414,8 @@ struct DistFront
     // is not needed after the factorization (and can be freed).
 
     // When this node is a duplicate of a sequential node, L1D or L2D will be
-    // attached to the sequential L matrix of the duplicate
+    // attached to the sequential L matrix of the duplicate (which only holds
+    // the top-left block after a BLR factorization)
 
     DistMatrix<F,VC,STAR> L1D;
     DistMatrix<F> L2D;
@@ -354,6 +458,15 @@ struct DistFront
             vector<Int>& mappedTargets,
             vector<Int>& colOffs,
       bool conjugate=false );
+    // Reuse all of the metadata (and the fronts) of a previous pull with the
+    // same sparsity pattern so that only the values are communicated
+    void Pull
+    ( const DistSparseMatrix<F>& A,
+      const DistMap& reordering,
+      const DistSeparator& rootSep,
+      const DistNodeInfo& info,
+            DistFrontPullMeta& meta,
+      bool conjugate=false );
 
     void PullUpdate
     ( const DistSparseMatrix<F>& A,
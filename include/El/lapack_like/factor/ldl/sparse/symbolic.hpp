@@ -70,6 +70,39 @@ void NaturalNestedDissection
         Int cutoff,
         bool storeFactRecvInds=false );
 
+// Merge the fronts of a sequential elimination tree into their parents
+// whenever the fraction of explicit zeros in the merged front is at most
+// 'tol'. The fronts are renumbered in place, but the analysis must be rerun.
+void Amalgamate( Separator& rootSep, NodeInfo& rootInfo, double tol );
+
+struct FrontStats
+{
+    Int numFronts=0;
+    // The number of entries of the factor, including the explicit zeros
+    // stored within the fronts
+    double numEntries=0;
+    double numFlops=0;
+    // The number of fronts whose size lies in [2^k,2^(k+1))
+    vector<Int> sizeHistogram;
+};
+
+FrontStats GetFrontStats( const NodeInfo& rootInfo );
+void PrintFrontStats
+( const FrontStats& stats, const string& label, ostream& os=cout );
+
+// Predict the fronts resulting from nested dissection and from a single
+// minimum-degree ordering of the graph so that the cheaper ordering can be
+// chosen before any numerical factorization
+struct OrderingReport
+{
+    FrontStats nestedDissection;
+    FrontStats minDegree;
+};
+
+OrderingReport CompareOrderings
+( const Graph& graph, const BisectCtrl& ctrl=BisectCtrl() );
+void PrintOrderingReport( const OrderingReport& report, ostream& os=cout );
+
 void BuildMap( const Separator& rootSep, vector<Int>& map );
 void BuildMap( const DistSeparator& rootSep, DistMap& map );
 
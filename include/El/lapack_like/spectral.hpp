@@ -1340,6 +1340,75 @@ SVDInfo TSQR
 
 } // namespace svd
 
+// Randomized low-rank SVD
+// =======================
+// Approximate the 'rank' dominant singular triplets of A using the randomized
+// range finder of Halko, Martinsson, and Tropp: an orthonormal basis Q for
+// the range of A Omega, with Omega a Gaussian matrix with 'oversample' more
+// columns than the rank, is refined with power iterations on (A A^H) and the
+// SVD of the small matrix Q^H A is then used to form U, s, and V.
+//
+// The single-pass variant of Tropp et al. only accesses A to form the two
+// sketches A Omega and Psi A (which are independent of each other) and then
+// recovers Q^H A from a small least-squares problem. It is therefore suited
+// to streamed data but is less accurate, and no power iterations are
+// performed.
+
+enum RandomizedSVDOrtho
+{
+  // Householder QR, which is performed with TSQR in the distributed case
+  RANDOMIZED_SVD_HOUSEHOLDER,
+
+  // Cholesky QR, repeated once to restore orthogonality ("CholeskyQR2").
+  // This only requires a single reduction but assumes that each basis is
+  // numerically of full rank.
+  RANDOMIZED_SVD_CHOLESKY_QR
+};
+
+template<typename Real>
+struct RandomizedSVDCtrl
+{
+    Int rank=10;
+    Int oversample=10;
+    Int numPowerIts=1;
+    RandomizedSVDOrtho ortho=RANDOMIZED_SVD_HOUSEHOLDER;
+    TSQRCtrl tsqrCtrl;
+    bool singlePass=false;
+
+    // For the SVD of the small projected matrix
+    SVDCtrl<Real> svdCtrl;
+};
+
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+template<typename F>
+void RandomizedSVD
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& s,
+        AbstractDistMatrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+
+template<typename F>
+void RandomizedSVD
+( const SparseMatrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+template<typename F>
+void RandomizedSVD
+( const DistSparseMatrix<F>& A,
+        DistMultiVec<F>& U,
+        Matrix<Base<F>>& s,
+        DistMultiVec<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+
 // Hermitian SVD
 // =============
 
@@ -20,10 +20,17 @@ struct BisectCtrl
     Int numSeqSeps;
     Int cutoff;
     bool storeFactRecvInds;
+    // Merge each sequential front into its parent if at most this fraction
+    // of the merged front would be explicit zeros (zero disables merging)
+    double amalgamationTol;
+    // Order each sequential subgraph with a single (approximate) minimum
+    // degree ordering rather than recursing with nested dissection. This is
+    // forced when METIS is not available.
+    bool minDegree;
 
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false), amalgamationTol(0), minDegree(false)
     { }
 };
 
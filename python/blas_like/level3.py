@@ -16,7 +16,7 @@ from ..core import *
 
 # Emulate an enum for the Gemm algorithm
 (GEMM_DEFAULT,GEMM_SUMMA_A,GEMM_SUMMA_B,GEMM_SUMMA_C,GEMM_SUMMA_DOT,
- GEMM_CANNON)=(0,1,2,3,4,5)
+ GEMM_CANNON,GEMM_SUMMA_C_PIPELINED,GEMM_25D)=(0,1,2,3,4,5,6,7)
 
 lib.ElGemm_i.argtypes = [c_uint,c_uint,iType,c_void_p,c_void_p,iType,c_void_p]
 lib.ElGemm_s.argtypes = [c_uint,c_uint,sType,c_void_p,c_void_p,sType,c_void_p]
@@ -490,7 +490,7 @@ class RegSolveCtrl_d(ctypes.Structure):
 # ================
 
 # Emulate an enum for the pivot type for LU factorization
-(LU_PARTIAL,LU_FULL,LU_ROOK,LU_WITHOUT_PIVOTING)=(0,1,2,3)
+(LU_PARTIAL,LU_FULL,LU_ROOK,LU_WITHOUT_PIVOTING,LU_TOURNAMENT)=(0,1,2,3,4)
 
 lib.ElLU_s.argtypes = \
 lib.ElLU_d.argtypes = \
@@ -8,27 +8,90 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <stack>
+#include <tuple>
 
 namespace {
 using namespace El;
 
-std::stack<Int> blocksizeStack;
+// Used by threads which have not pushed onto their own blocksize stack
+const Int defaultBlocksize = 128;
+thread_local std::stack<Int> blocksizeStack;
 
-template<typename T>
-struct LocalSymvBlocksizeHelper { static Int value; };
-template<typename T>
-Int LocalSymvBlocksizeHelper<T>::value = 64;
+// Explicit (routine,datatype) blocksizes for the calling thread
+typedef std::pair<string,string> RoutineKey;
+thread_local std::map<RoutineKey,Int> routineBlocksizes;
 
+// Autotuned blocksizes shared by all threads, keyed by routine, datatype,
+// and the problem shape rounded up to powers of two. Every modification
+// (made while holding the mutex) bumps the version so that lookups can
+// read a thread-local snapshot of the cache without locking.
+typedef std::tuple<string,string,Int,Int> TuningKey;
+std::mutex tuningMutex;
+std::atomic<bool> blocksizeTuning(false);
+vector<Int> blocksizeCandidates = { 16, 32, 48, 64, 96, 128, 192, 256 };
+std::map<TuningKey,Int> tunedBlocksizes;
+std::atomic<size_t> tuningVersion(0);
+
+thread_local std::map<TuningKey,Int> tunedSnapshot;
+thread_local size_t tunedSnapshotVersion = 0;
+
+const std::map<TuningKey,Int>& TunedBlocksizes()
+{
+    if( ::tunedSnapshotVersion != ::tuningVersion.load() )
+    {
+        std::lock_guard<std::mutex> guard(::tuningMutex);
+        ::tunedSnapshot = ::tunedBlocksizes;
+        ::tunedSnapshotVersion = ::tuningVersion.load();
+    }
+    return ::tunedSnapshot;
+}
+
+// Formatting the datatype name is far more expensive than the lookups
 template<typename T>
-struct LocalTrrkBlocksizeHelper { static Int value; };
-template<typename T>
-Int LocalTrrkBlocksizeHelper<T>::value = 64;
+const string& CachedTypeName()
+{
+    static const string typeName = TypeName<T>();
+    return typeName;
+}
+
+Int ShapeBucket( Int n )
+{
+    Int bucket = 1;
+    while( bucket < n )
+        bucket *= 2;
+    return bucket;
+}
 
 template<typename T>
-struct LocalTrr2kBlocksizeHelper { static Int value; };
+bool ExplicitBlocksize( const string& routine, Int& blocksize )
+{
+    if( ::routineBlocksizes.empty() )
+        return false;
+    auto it =
+      ::routineBlocksizes.find( RoutineKey(routine,CachedTypeName<T>()) );
+    if( it == ::routineBlocksizes.end() )
+        return false;
+    blocksize = it->second;
+    return true;
+}
+
 template<typename T>
-Int LocalTrr2kBlocksizeHelper<T>::value = 64;
+bool TunedBlocksize( const string& routine, Int m, Int n, Int& blocksize )
+{
+    const auto& tuned = TunedBlocksizes();
+    if( tuned.empty() )
+        return false;
+    auto it = tuned.find
+      ( TuningKey(routine,CachedTypeName<T>(),ShapeBucket(m),ShapeBucket(n)) );
+    if( it == tuned.end() )
+        return false;
+    blocksize = it->second;
+    return true;
+}
 
 }
 
@@ -36,10 +99,8 @@ namespace El {
 
 Int Blocksize()
 { 
-    DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
-          LogicError("Attempted to extract blocksize from empty stack");
-    )
+    if( ::blocksizeStack.empty() )
+        return ::defaultBlocksize;
     return ::blocksizeStack.top(); 
 }
 
@@ -70,37 +131,181 @@ void EmptyBlocksizeStack()
         ::blocksizeStack.pop();
 }
 
+template<typename T>
+Int Blocksize( const string& routine, Int defaultBlocksize )
+{
+    Int blocksize;
+    if( ExplicitBlocksize<T>( routine, blocksize ) )
+        return blocksize;
+    return defaultBlocksize;
+}
+
+template<typename T>
+void SetBlocksize( const string& routine, Int blocksize )
+{ ::routineBlocksizes[RoutineKey(routine,CachedTypeName<T>())] = blocksize; }
+
+template<typename T>
+void ClearBlocksize( const string& routine )
+{ ::routineBlocksizes.erase( RoutineKey(routine,CachedTypeName<T>()) ); }
+
+template<typename T>
+Int Blocksize( const string& routine, Int m, Int n, Int defaultBlocksize )
+{
+    Int blocksize;
+    if( ExplicitBlocksize<T>( routine, blocksize ) ||
+        TunedBlocksize<T>( routine, m, n, blocksize ) )
+        return blocksize;
+    return defaultBlocksize;
+}
+
+template<typename T>
+Int Blocksize
+( const string& routine, Int m, Int n,
+  function<void(Int)> trial, Int defaultBlocksize )
+{
+    DEBUG_CSE
+    Int blocksize;
+    if( ExplicitBlocksize<T>( routine, blocksize ) ||
+        TunedBlocksize<T>( routine, m, n, blocksize ) )
+        return blocksize;
+    if( !::blocksizeTuning )
+        return defaultBlocksize;
+
+    const TuningKey key
+      ( routine, CachedTypeName<T>(), ShapeBucket(m), ShapeBucket(n) );
+    vector<Int> candidates;
+    {
+        // Another thread may have finished tuning since our snapshot
+        std::lock_guard<std::mutex> guard(::tuningMutex);
+        auto tunedIt = ::tunedBlocksizes.find( key );
+        if( tunedIt != ::tunedBlocksizes.end() )
+            return tunedIt->second;
+        candidates = ::blocksizeCandidates;
+    }
+
+    // The trials are run without holding the lock since they will typically
+    // query the blocksizes of their subroutines
+    Int bestBlocksize = defaultBlocksize;
+    double bestTime = -1;
+    Timer timer;
+    for( const Int candidate : candidates )
+    {
+        if( candidate > Max(m,n) && bestTime >= 0 )
+            break;
+        timer.Start();
+        trial( candidate );
+        const double time = timer.Stop();
+        if( bestTime < 0 || time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = candidate;
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(::tuningMutex);
+    ::tunedBlocksizes[key] = bestBlocksize;
+    ++::tuningVersion;
+    return bestBlocksize;
+}
+
+void SetBlocksizeTuning( bool tune )
+{ ::blocksizeTuning = tune; }
+
+bool BlocksizeTuning()
+{ return ::blocksizeTuning; }
+
+void SetBlocksizeCandidates( const vector<Int>& candidates )
+{
+    DEBUG_CSE
+    if( candidates.empty() )
+        LogicError("Need at least one candidate blocksize");
+    std::lock_guard<std::mutex> guard(::tuningMutex);
+    ::blocksizeCandidates = candidates;
+    std::sort( ::blocksizeCandidates.begin(), ::blocksizeCandidates.end() );
+}
+
+vector<Int> BlocksizeCandidates()
+{
+    std::lock_guard<std::mutex> guard(::tuningMutex);
+    return ::blocksizeCandidates;
+}
+
+// Each line of the file is of the form "routine type m n blocksize"
+void SaveTunedBlocksizes( const string& filename )
+{
+    DEBUG_CSE
+    ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    std::lock_guard<std::mutex> guard(::tuningMutex);
+    for( const auto& entry : ::tunedBlocksizes )
+        file << std::get<0>(entry.first) << " "
+             << std::get<1>(entry.first) << " "
+             << std::get<2>(entry.first) << " "
+             << std::get<3>(entry.first) << " "
+             << entry.second << "\n";
+}
+
+void LoadTunedBlocksizes( const string& filename )
+{
+    DEBUG_CSE
+    ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    string routine, typeName;
+    Int m, n, blocksize;
+    std::lock_guard<std::mutex> guard(::tuningMutex);
+    while( file >> routine >> typeName >> m >> n >> blocksize )
+        ::tunedBlocksizes[TuningKey(routine,typeName,m,n)] = blocksize;
+    ++::tuningVersion;
+}
+
+void ClearTunedBlocksizes()
+{
+    std::lock_guard<std::mutex> guard(::tuningMutex);
+    ::tunedBlocksizes.clear();
+    ++::tuningVersion;
+}
+
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
-{ LocalSymvBlocksizeHelper<T>::value = blocksize; }
+{ SetBlocksize<T>( "LocalSymv", blocksize ); }
 
 template<typename T>
 Int LocalSymvBlocksize()
-{ return LocalSymvBlocksizeHelper<T>::value; }
+{ return Blocksize<T>( "LocalSymv", 64 ); }
 
 template<typename T>
 void SetLocalTrrkBlocksize( Int blocksize )
-{ LocalTrrkBlocksizeHelper<T>::value = blocksize; }
+{ SetBlocksize<T>( "LocalTrrk", blocksize ); }
 
 template<typename T>
 Int LocalTrrkBlocksize()
-{ return LocalTrrkBlocksizeHelper<T>::value; }
+{ return Blocksize<T>( "LocalTrrk", 64 ); }
 
 template<typename T>
 void SetLocalTrr2kBlocksize( Int blocksize )
-{ LocalTrr2kBlocksizeHelper<T>::value = blocksize; }
+{ SetBlocksize<T>( "LocalTrr2k", blocksize ); }
 
 template<typename T>
 Int LocalTrr2kBlocksize()
-{ return LocalTrr2kBlocksizeHelper<T>::value; }
+{ return Blocksize<T>( "LocalTrr2k", 64 ); }
 
 #define PROTO(T) \
+  template Int Blocksize<T>( const string& routine, Int defaultBlocksize ); \
+  template void SetBlocksize<T>( const string& routine, Int blocksize ); \
+  template void ClearBlocksize<T>( const string& routine ); \
+  template Int Blocksize<T> \
+  ( const string& routine, Int m, Int n, Int defaultBlocksize ); \
+  template Int Blocksize<T> \
+  ( const string& routine, Int m, Int n, \
+    function<void(Int)> trial, Int defaultBlocksize ); \
   template void SetLocalSymvBlocksize<T>( Int blocksize ); \
   template Int LocalSymvBlocksize<T>(); \
   template void SetLocalTrrkBlocksize<T>( Int blocksize ); \
   template Int LocalTrrkBlocksize<T>(); \
   template void SetLocalTrr2kBlocksize<T>( Int blocksize ); \
-  template Int LocalTrr2kBlocksize<T>(); 
+  template Int LocalTrr2kBlocksize<T>();
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -13,9 +13,210 @@
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/SUMMA25D.hpp"
 
 namespace El {
 
+namespace {
+
+GemmCostModel gemmCostModel;
+
+// The number of stages of a tree-based collective over p processes
+double NumStages( Int p )
+{ return p > 1 ? std::ceil(std::log2(double(p))) : 0.; }
+
+double gemm25DMemoryLimit = 0;
+
+} // anonymous namespace
+
+void SetGemmCostModel( const GemmCostModel& model )
+{ gemmCostModel = model; }
+
+GemmCostModel GetGemmCostModel()
+{ return gemmCostModel; }
+
+GemmCostModel CalibrateGemmCostModel( const Grid& grid, Int numReps )
+{
+    DEBUG_CSE
+    GemmCostModel model = GetGemmCostModel();
+    mpi::Comm comm = grid.Comm();
+    const Int p = grid.Size();
+    const double numStages = NumStages( p );
+    Timer timer;
+
+    if( p > 1 )
+    {
+        double value = 0;
+        mpi::Barrier( comm );
+        timer.Start();
+        for( Int rep=0; rep<numReps; ++rep )
+            mpi::Broadcast( value, 0, comm );
+        model.latency = timer.Stop() / (numReps*numStages);
+
+        // Long broadcasts are typically a scatter followed by an all-gather
+        const Int numEntries = 1 << 20;
+        vector<double> buffer( numEntries, 0 );
+        mpi::Barrier( comm );
+        timer.Start();
+        for( Int rep=0; rep<numReps; ++rep )
+            mpi::Broadcast( buffer.data(), numEntries, 0, comm );
+        const double broadcastTime = timer.Stop() / numReps;
+        const double numBytes = 2.*(p-1.)/p*numEntries*sizeof(double);
+        model.inverseBandwidth =
+          Max( broadcastTime-numStages*model.latency, 0. ) / numBytes;
+    }
+
+    const Int n = 256;
+    Matrix<double> A( n, n ), B( n, n ), C( n, n );
+    Fill( A, 1. );
+    Fill( B, 1. );
+    timer.Start();
+    for( Int rep=0; rep<numReps; ++rep )
+        Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    model.flopTime = timer.Stop() / (numReps*2.*n*n*n);
+
+    // Every process must select the same algorithms
+    model.latency = mpi::AllReduce( model.latency, mpi::MAX, comm );
+    model.inverseBandwidth =
+      mpi::AllReduce( model.inverseBandwidth, mpi::MAX, comm );
+    model.flopTime = mpi::AllReduce( model.flopTime, mpi::MAX, comm );
+
+    return model;
+}
+
+double GemmCost
+( GemmAlgorithm alg, Int m, Int n, Int sumDim,
+  const Grid& grid, Int typeSize,
+  const GemmCostModel& model )
+{
+    DEBUG_CSE
+    const double r = grid.Height();
+    const double c = grid.Width();
+    const double p = grid.Size();
+    const double bsize = Blocksize();
+    const double mDbl = m;
+    const double nDbl = n;
+    const double kDbl = sumDim;
+
+    // The number of messages and entries communicated by each process
+    double numMessages, numEntries;
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:
+        // Each panel of B is redistributed into [*,MR], and the corresponding
+        // panel of A B is summed and scattered within process rows
+        numMessages =
+          std::ceil(nDbl/bsize)*
+          (NumStages(grid.Size())+NumStages(grid.Height())+
+           NumStages(grid.Width()));
+        numEntries =
+          nDbl*(kDbl/p + kDbl*(r-1)/(r*c) + mDbl*(c-1)/(r*c));
+        break;
+    case GEMM_SUMMA_B:
+        // Each panel of A is redistributed into [*,MC], and the corresponding
+        // panel of A B is summed and scattered within process columns
+        numMessages =
+          std::ceil(mDbl/bsize)*
+          (NumStages(grid.Size())+NumStages(grid.Height())+
+           NumStages(grid.Width()));
+        numEntries =
+          mDbl*(kDbl/p + kDbl*(c-1)/(r*c) + nDbl*(r-1)/(r*c));
+        break;
+    case GEMM_SUMMA_C:
+    case GEMM_SUMMA_C_PIPELINED:
+        // Each panel of A is gathered within process rows and each panel of B
+        // within process columns
+        numMessages =
+          std::ceil(kDbl/bsize)*
+          (NumStages(grid.Height())+NumStages(grid.Width()));
+        numEntries = kDbl*(mDbl*(c-1)/(r*c) + nDbl*(r-1)/(r*c));
+        break;
+    case GEMM_SUMMA_DOT:
+    {
+        // A and B are redistributed over the entire grid, and then each block
+        // of C is summed and scattered over the entire grid
+        const double blockSizeDot = model.blockSizeDot;
+        const double numBlocks =
+          std::ceil(mDbl/blockSizeDot)*std::ceil(nDbl/blockSizeDot);
+        numMessages = (2+numBlocks)*NumStages(grid.Size());
+        numEntries = (mDbl+nDbl)*kDbl/p + mDbl*nDbl*(p-1)/p;
+        break;
+    }
+    default:
+        LogicError("GemmCost only supports the SUMMA variants");
+        return 0;
+    }
+    const double commTime =
+      model.latency*numMessages + model.inverseBandwidth*typeSize*numEntries;
+    const double computeTime = model.flopTime*2*mDbl*nDbl*kDbl/p;
+    if( alg == GEMM_SUMMA_C_PIPELINED )
+    {
+        // All but the first panel's gathers are hidden behind local updates
+        const double numPanels = Max( std::ceil(kDbl/bsize), 1. );
+        return commTime/numPanels + Max( commTime, computeTime );
+    }
+    return commTime + computeTime;
+}
+
+GemmAlgorithm SelectGemmAlgorithm
+( Int m, Int n, Int sumDim, const Grid& grid, Int typeSize,
+  const GemmCostModel& model )
+{
+    DEBUG_CSE
+    // Ties are broken in favor of the earlier variants
+    const GemmAlgorithm algs[] =
+      { GEMM_SUMMA_C, GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_DOT };
+    GemmAlgorithm bestAlg = GEMM_SUMMA_C;
+    double bestCost = -1;
+    for( const GemmAlgorithm alg : algs )
+    {
+        const double cost =
+          GemmCost( alg, m, n, sumDim, grid, typeSize, model );
+        if( bestCost < 0 || cost < bestCost )
+        {
+            bestAlg = alg;
+            bestCost = cost;
+        }
+    }
+    return bestAlg;
+}
+
+void SetGemm25DMemoryLimit( double numBytes )
+{ gemm25DMemoryLimit = numBytes; }
+
+double Gemm25DMemoryLimit()
+{ return gemm25DMemoryLimit; }
+
+Int Gemm25DDepth( Int m, Int n, Int sumDim, const Grid& grid, Int typeSize )
+{
+    DEBUG_CSE
+    // The layers are carved out of the VC communicator, which does not
+    // include any non-owning viewers
+    if( grid.HaveViewers() )
+        return 1;
+    const Int p = grid.Size();
+    double memoryLimit = gemm25DMemoryLimit;
+    if( memoryLimit == 0 )
+        memoryLimit = grid.FreeMemoryPerProcess();
+
+    // Each process stores 1/p'th of A and B and depth/p'th of C, and the
+    // requirement grows with the depth
+    const double mDbl = m;
+    const double nDbl = n;
+    const double kDbl = sumDim;
+    Int depth = 1;
+    for( Int c=2; c*c*c<=p && c<=sumDim; ++c )
+    {
+        if( p % c != 0 )
+            continue;
+        const double numBytes = typeSize*(mDbl*kDbl+kDbl*nDbl+c*mDbl*nDbl)/p;
+        if( numBytes > memoryLimit )
+            break;
+        depth = c;
+    }
+    return depth;
+}
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -96,6 +297,11 @@ void Gemm
 {
     DEBUG_CSE
     C *= beta;
+    if( alg == GEMM_25D )
+    {
+        gemm::SUMMA25D( orientA, orientB, alpha, A, B, C );
+        return;
+    }
     if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
@@ -217,6 +217,137 @@ void SUMMA_NNC
     }
 }
 
+// Normal Normal Gemm that avoids communicating the matrix C and overlaps the
+// gathers of the next panels of A and B with the current local update
+//
+// Rather than redistributing each panel through blocking DistMatrix
+// assignments, the local portions of A1 and B1 are packed into fixed-size
+// buffers and all-gathered within process rows and columns using non-blocking
+// collectives, so that panel k+1 is in flight while panel k is multiplied.
+//
+template<typename T>
+void SUMMA_NNCPipelined
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+    const Int r = g.Height();
+    const Int c = g.Width();
+
+    // Force A and B to be in [MC,MR] distributions aligned with C so that
+    // the gathered panels are aligned with our local portion of C
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+    mpi::Comm rowComm = A.RowComm();
+    mpi::Comm colComm = B.ColComm();
+
+    // Each process contributes at most ceil(nb/c) columns of A1 and at most
+    // ceil(nb/r) rows of B1, and we pad every contribution to that size
+    vector<T> sendA[2], recvA[2], sendB[2], recvB[2];
+    mpi::Request<T> requestA[2], requestB[2];
+
+    auto startPanel = [&]( Int k, Int buf )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        const Int maxWidthA = MaxLength( nb, c );
+        const Int maxHeightB = MaxLength( nb, r );
+        auto A1 = A( ALL,        IR(k,k+nb) );
+        auto B1 = B( IR(k,k+nb), ALL        );
+        const Int localWidthA1 = A1.LocalWidth();
+        const Int localHeightB1 = B1.LocalHeight();
+
+        const Int pkgSizeA = localHeight*maxWidthA;
+        FastResize( sendA[buf], pkgSizeA );
+        FastResize( recvA[buf], c*pkgSizeA );
+        for( Int jLoc=0; jLoc<localWidthA1; ++jLoc )
+            MemCopy
+            ( sendA[buf].data()+jLoc*localHeight, A1.LockedBuffer(0,jLoc),
+              localHeight );
+        mpi::IAllGather
+        ( sendA[buf].data(), pkgSizeA, recvA[buf].data(), pkgSizeA,
+          rowComm, requestA[buf] );
+
+        const Int pkgSizeB = maxHeightB*localWidth;
+        FastResize( sendB[buf], pkgSizeB );
+        FastResize( recvB[buf], r*pkgSizeB );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            MemCopy
+            ( sendB[buf].data()+jLoc*maxHeightB, B1.LockedBuffer(0,jLoc),
+              localHeightB1 );
+        mpi::IAllGather
+        ( sendB[buf].data(), pkgSizeB, recvB[buf].data(), pkgSizeB,
+          colComm, requestB[buf] );
+    };
+
+    Matrix<T> A1_MC_STAR, B1_STAR_MR;
+    if( sumDim > 0 )
+        startPanel( 0, 0 );
+    for( Int k=0, buf=0; k<sumDim; k+=bsize, buf=1-buf )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        const Int maxWidthA = MaxLength( nb, c );
+        const Int maxHeightB = MaxLength( nb, r );
+        const Int rowAlignA1 = Mod( A.RowAlign()+k, c );
+        const Int colAlignB1 = Mod( B.ColAlign()+k, r );
+
+        mpi::Wait( requestA[buf] );
+        mpi::Wait( requestB[buf] );
+        if( k+bsize < sumDim )
+            startPanel( k+bsize, 1-buf );
+
+        // Unpack A1[MC,*] from the contributions of each process column
+        const Int pkgSizeA = localHeight*maxWidthA;
+        A1_MC_STAR.Resize( localHeight, nb );
+        for( Int q=0; q<c; ++q )
+        {
+            const Int shift = Shift( q, rowAlignA1, c );
+            const Int width = Length( nb, shift, c );
+            const T* pkg = recvA[buf].data()+q*pkgSizeA;
+            for( Int jLoc=0; jLoc<width; ++jLoc )
+                MemCopy
+                ( A1_MC_STAR.Buffer(0,shift+jLoc*c), pkg+jLoc*localHeight,
+                  localHeight );
+        }
+
+        // Unpack B1[*,MR] from the contributions of each process row
+        const Int pkgSizeB = maxHeightB*localWidth;
+        B1_STAR_MR.Resize( nb, localWidth );
+        for( Int q=0; q<r; ++q )
+        {
+            const Int shift = Shift( q, colAlignB1, r );
+            const Int height = Length( nb, shift, r );
+            const T* pkg = recvB[buf].data()+q*pkgSizeB;
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                const T* pkgCol = pkg+jLoc*maxHeightB;
+                for( Int iLoc=0; iLoc<height; ++iLoc )
+                    B1_STAR_MR(shift+iLoc*r,jLoc) = pkgCol[iLoc];
+            }
+        }
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        Gemm
+        ( NORMAL, NORMAL, alpha, A1_MC_STAR, B1_STAR_MR, T(1), C.Matrix() );
+    }
+}
+
 // Normal Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -293,28 +424,22 @@ void SUMMA_NN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const GemmCostModel model = GetGemmCostModel();
+    if( alg == GEMM_DEFAULT )
+        alg = SelectGemmAlgorithm
+          ( m, n, sumDim, A.Grid(), SerializedSize<T>(), model );
 
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_NNDot( alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_NNB( alpha, A, B, C );    
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_NNA( alpha, A, B, C );
-        else
-            SUMMA_NNC( alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A:   SUMMA_NNA( alpha, A, B, C ); break;
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
-    case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_NNCPipelined( alpha, A, B, C );
+        break;
+    case GEMM_SUMMA_DOT:
+        SUMMA_NNDot( alpha, A, B, C, model.blockSizeDot );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -227,28 +227,22 @@ void SUMMA_NT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const GemmCostModel model = GetGemmCostModel();
+    if( alg == GEMM_DEFAULT )
+        alg = SelectGemmAlgorithm
+          ( m, n, sumDim, A.Grid(), SerializedSize<T>(), model );
 
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_NTDot( orientB, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_NTB( orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_NTA( orientB, alpha, A, B, C );
-        else
-            SUMMA_NTC( orientB, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A: SUMMA_NTA( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
-    case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
-    case GEMM_SUMMA_DOT: SUMMA_NTDot( orientB, alpha, A, B, C ); break;
+    case GEMM_SUMMA_C:
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_NTC( orientB, alpha, A, B, C );
+        break;
+    case GEMM_SUMMA_DOT:
+        SUMMA_NTDot( orientB, alpha, A, B, C, model.blockSizeDot );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
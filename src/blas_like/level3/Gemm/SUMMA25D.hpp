@@ -0,0 +1,281 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The 2.5D algorithm splits the p processes of the grid into numLayers
+// layers of p/numLayers processes, each of which forms its own 2D grid.
+// Layer l is assigned the l'th slice of the summation dimension, so that it
+// only needs the corresponding columns of A and rows of B, and the layers
+// then multiply their slices simultaneously using SUMMA before summing their
+// contributions to C. Relative to SUMMA over the entire grid, the per-process
+// bandwidth of the multiplication is reduced by a factor of sqrt(numLayers)
+// in exchange for storing numLayers-fold copies of (the local portion of) C.
+//
+// Layer l consists of the processes with VC ranks in
+// [l*layerSize,(l+1)*layerSize), and its grid is column-major in the
+// remainder of the VC rank.
+
+// Send the piece of X assigned to each layer to the [MC,MR] distribution of
+// XLayer over the layer's grid. If sliceCols is true, the l'th layer is
+// assigned columns [l*sliceSize,(l+1)*sliceSize) of X, otherwise it is
+// assigned the corresponding rows.
+template<typename T>
+void ScatterToLayers
+( const DistMatrix<T>& X,
+        DistMatrix<T>& XLayer,
+  bool sliceCols, Int sliceSize )
+{
+    DEBUG_CSE
+    const Grid& g = X.Grid();
+    const Grid& layerGrid = XLayer.Grid();
+    mpi::Comm comm = g.VCComm();
+    const int commSize = mpi::Size( comm );
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int rLayer = layerGrid.Height();
+    const Int cLayer = layerGrid.Width();
+    const Int layerSize = layerGrid.Size();
+    const Int layer = g.VCRank() / layerSize;
+    const Int offset = layer*sliceSize;
+
+    // Every (source,destination) pair traverses the entries that it shares
+    // in column-major order, so only the values need to be communicated
+    auto destination =
+      [&]( Int i, Int j )
+      {
+          const Int index = ( sliceCols ? j : i );
+          const Int destLayer = index / sliceSize;
+          const Int iLayer = ( sliceCols ? i : i-destLayer*sliceSize );
+          const Int jLayer = ( sliceCols ? j-destLayer*sliceSize : j );
+          return destLayer*layerSize +
+                 Mod(iLayer+XLayer.ColAlign(),rLayer) +
+                 Mod(jLayer+XLayer.RowAlign(),cLayer)*rLayer;
+      };
+    auto source =
+      [&]( Int i, Int j )
+      { return Mod(i+X.ColAlign(),r) + Mod(j+X.RowAlign(),c)*r; };
+
+    const Int localHeight = X.LocalHeight();
+    const Int localWidth = X.LocalWidth();
+    vector<int> sendCounts(commSize,0);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = X.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            ++sendCounts[destination(X.GlobalRow(iLoc),j)];
+    }
+
+    const Int localHeightLayer = XLayer.LocalHeight();
+    const Int localWidthLayer = XLayer.LocalWidth();
+    vector<int> recvCounts(commSize,0);
+    for( Int jLoc=0; jLoc<localWidthLayer; ++jLoc )
+    {
+        const Int jLayer = XLayer.GlobalCol(jLoc);
+        const Int j = ( sliceCols ? jLayer+offset : jLayer );
+        for( Int iLoc=0; iLoc<localHeightLayer; ++iLoc )
+        {
+            const Int iLayer = XLayer.GlobalRow(iLoc);
+            const Int i = ( sliceCols ? iLayer : iLayer+offset );
+            ++recvCounts[source(i,j)];
+        }
+    }
+
+    vector<int> sendOffs, recvOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<T> sendBuf, recvBuf;
+    FastResize( sendBuf, totalSend );
+    FastResize( recvBuf, totalRecv );
+
+    auto offsets = sendOffs;
+    const T* XBuf = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = X.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int q = destination(X.GlobalRow(iLoc),j);
+            sendBuf[offsets[q]++] = XBuf[iLoc+jLoc*XLDim];
+        }
+    }
+
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+
+    offsets = recvOffs;
+    T* XLayerBuf = XLayer.Buffer();
+    const Int XLayerLDim = XLayer.LDim();
+    for( Int jLoc=0; jLoc<localWidthLayer; ++jLoc )
+    {
+        const Int jLayer = XLayer.GlobalCol(jLoc);
+        const Int j = ( sliceCols ? jLayer+offset : jLayer );
+        for( Int iLoc=0; iLoc<localHeightLayer; ++iLoc )
+        {
+            const Int iLayer = XLayer.GlobalRow(iLoc);
+            const Int i = ( sliceCols ? iLayer : iLayer+offset );
+            XLayerBuf[iLoc+jLoc*XLayerLDim] = recvBuf[offsets[source(i,j)]++];
+        }
+    }
+}
+
+// Add the copies of C formed by each of the layers into the [MC,MR]
+// distribution over the entire grid
+template<typename T>
+void ContractFromLayers
+( const DistMatrix<T>& CLayer,
+        DistMatrix<T>& C )
+{
+    DEBUG_CSE
+    const Grid& g = C.Grid();
+    const Grid& layerGrid = CLayer.Grid();
+    mpi::Comm comm = g.VCComm();
+    const int commSize = mpi::Size( comm );
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int rLayer = layerGrid.Height();
+    const Int cLayer = layerGrid.Width();
+    const Int layerSize = layerGrid.Size();
+    const Int numLayers = g.Size() / layerSize;
+
+    auto destination =
+      [&]( Int i, Int j )
+      { return Mod(i+C.ColAlign(),r) + Mod(j+C.RowAlign(),c)*r; };
+    auto layerOwner =
+      [&]( Int i, Int j )
+      { return Mod(i+CLayer.ColAlign(),rLayer) +
+               Mod(j+CLayer.RowAlign(),cLayer)*rLayer; };
+
+    const Int localHeightLayer = CLayer.LocalHeight();
+    const Int localWidthLayer = CLayer.LocalWidth();
+    vector<int> sendCounts(commSize,0);
+    for( Int jLoc=0; jLoc<localWidthLayer; ++jLoc )
+    {
+        const Int j = CLayer.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeightLayer; ++iLoc )
+            ++sendCounts[destination(CLayer.GlobalRow(iLoc),j)];
+    }
+
+    // Every entry of C receives one contribution from each layer
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+    vector<int> recvCounts(commSize,0);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = C.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int owner = layerOwner(C.GlobalRow(iLoc),j);
+            for( Int l=0; l<numLayers; ++l )
+                ++recvCounts[l*layerSize+owner];
+        }
+    }
+
+    vector<int> sendOffs, recvOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<T> sendBuf, recvBuf;
+    FastResize( sendBuf, totalSend );
+    FastResize( recvBuf, totalRecv );
+
+    auto offsets = sendOffs;
+    const T* CLayerBuf = CLayer.LockedBuffer();
+    const Int CLayerLDim = CLayer.LDim();
+    for( Int jLoc=0; jLoc<localWidthLayer; ++jLoc )
+    {
+        const Int j = CLayer.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeightLayer; ++iLoc )
+        {
+            const int q = destination(CLayer.GlobalRow(iLoc),j);
+            sendBuf[offsets[q]++] = CLayerBuf[iLoc+jLoc*CLayerLDim];
+        }
+    }
+
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+
+    offsets = recvOffs;
+    T* CBuf = C.Buffer();
+    const Int CLDim = C.LDim();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = C.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int owner = layerOwner(C.GlobalRow(iLoc),j);
+            for( Int l=0; l<numLayers; ++l )
+                CBuf[iLoc+jLoc*CLDim] += recvBuf[offsets[l*layerSize+owner]++];
+        }
+    }
+}
+
+template<typename T>
+void SUMMA25D
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int sumDim = ( orientA==NORMAL ? APre.Width() : APre.Height() );
+    const Grid& g = APre.Grid();
+    const Int numLayers = Gemm25DDepth( m, n, sumDim, g, SerializedSize<T>() );
+    if( numLayers == 1 )
+    {
+        Gemm( orientA, orientB, alpha, APre, BPre, T(1), CPre );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const Int layerSize = g.Size() / numLayers;
+    const Int layer = g.VCRank() / layerSize;
+    mpi::Comm layerComm;
+    mpi::Split( g.VCComm(), layer, g.VCRank()-layer*layerSize, layerComm );
+    {
+        const Grid layerGrid( layerComm, Grid::FindFactor(layerSize) );
+        const Int sliceSize = (sumDim+numLayers-1) / numLayers;
+        const Int offset = Min( layer*sliceSize, sumDim );
+        const Int nb = Min( sliceSize, sumDim-offset );
+
+        // A is sliced by columns when it is not transposed and B is sliced
+        // by rows when it is not transposed
+        DistMatrix<T> ALayer(layerGrid), BLayer(layerGrid), CLayer(layerGrid);
+        if( orientA == NORMAL )
+            ALayer.Resize( m, nb );
+        else
+            ALayer.Resize( nb, m );
+        if( orientB == NORMAL )
+            BLayer.Resize( nb, n );
+        else
+            BLayer.Resize( n, nb );
+        ScatterToLayers( A, ALayer, orientA==NORMAL, sliceSize );
+        ScatterToLayers( B, BLayer, orientB!=NORMAL, sliceSize );
+
+        Gemm( orientA, orientB, alpha, ALayer, BLayer, CLayer );
+        ContractFromLayers( CLayer, C );
+    }
+    mpi::Free( layerComm );
+}
+
+} // namespace gemm
+} // namespace El
@@ -239,24 +239,13 @@ void SUMMA_TT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const GemmCostModel model = GetGemmCostModel();
+    if( alg == GEMM_DEFAULT )
+        alg = SelectGemmAlgorithm
+          ( m, n, sumDim, A.Grid(), SerializedSize<T>(), model );
 
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_TTDot( orientA, orientB, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_TTB( orientA, orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_TTA( orientA, orientB, alpha, A, B, C );
-        else
-            SUMMA_TTC( orientA, orientB, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A:
         SUMMA_TTA( orientA, orientB, alpha, A, B, C );
         break;
@@ -264,10 +253,11 @@ void SUMMA_TT
         SUMMA_TTB( orientA, orientB, alpha, A, B, C );
         break;
     case GEMM_SUMMA_C:
+    case GEMM_SUMMA_C_PIPELINED:
         SUMMA_TTC( orientA, orientB, alpha, A, B, C );
         break;
     case GEMM_SUMMA_DOT:
-        SUMMA_TTDot( orientA, orientB, alpha, A, B, C );
+        SUMMA_TTDot( orientA, orientB, alpha, A, B, C, model.blockSizeDot );
         break;
     default: LogicError("Unsupported Gemm option");
     }
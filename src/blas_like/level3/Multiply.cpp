@@ -14,103 +14,193 @@
 namespace El {
 
 namespace {
-/**
- * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
- */
-template<typename T>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
+
+// The sparse-times-dense kernels below treat the multivectors through a row
+// stride and a column stride, so that x(i,k) lives at X[i*XRowStride+
+// k*XColStride]. Column-major multivectors therefore have a row stride of one
+// while the interleaved multivectors used for the distributed products have
+// a column stride of one.
+
+// The number of rows of A handled by each task of the NORMAL kernel
+const Int rowChunkSize = 64;
+
+// A null values buffer signifies a pattern-only matrix whose nonzeros are one
+template<typename T,bool pattern,bool conjugate>
+inline T Value( const T* values, Int e )
+{
+    if( pattern )
+        return T(1);
+    else if( conjugate )
+        return Conj(values[e]);
+    else
+        return values[e];
+}
+
+// Y := alpha A X + beta Y, streaming each row of A once for all of the
+// right-hand sides. If rows is non-null, only the m rows which it lists are
+// formed.
+template<typename T,bool pattern>
+void MultiplyCSRNormal
+( Int m, const Int* rows, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   x,
+  const T*   values,
+  const T*   X, Int XRowStride, Int XColStride,
   T beta,
-        T*   y )
+        T*   Y, Int YRowStride, Int YColStride )
 {
     DEBUG_CSE
-    if( orientation == NORMAL )
+    if( numRHS == 1 )
     {
-        for( Int i=0; i<m; ++i )
+        EL_PARALLEL_FOR
+        for( Int k=0; k<m; ++k )
         {
+            const Int i = ( rows == nullptr ? k : rows[k] );
             T sum = 0;
             const Int eStart = rowOffsets[i];
             const Int eStop = rowOffsets[i+1];
             for( Int e=eStart; e<eStop; ++e )
-                sum += x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
+                sum += Value<T,pattern,false>(values,e)*
+                       X[colIndices[e]*XRowStride];
+            T& eta = Y[i*YRowStride];
+            eta = alpha*sum + beta*eta;
         }
+        return;
     }
-    else
+
+    const Int numChunks = (m+rowChunkSize-1) / rowChunkSize;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
     {
-        for( Int j=0; j<n; ++j ){
-            y[j] *= beta;
-            for( Int i=0; i<m; ++i )
+        const Int iBeg = chunk*rowChunkSize;
+        const Int iEnd = Min(iBeg+rowChunkSize,m);
+        vector<T> sums( numRHS );
+        for( Int iList=iBeg; iList<iEnd; ++iList )
+        {
+            const Int i = ( rows == nullptr ? iList : rows[iList] );
+            for( Int k=0; k<numRHS; ++k )
+                sums[k] = 0;
+            const Int eStart = rowOffsets[i];
+            const Int eStop = rowOffsets[i+1];
+            for( Int e=eStart; e<eStop; ++e )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];         
+                const T value = Value<T,pattern,false>(values,e);
+                const T* XRow = &X[colIndices[e]*XRowStride];
+                for( Int k=0; k<numRHS; ++k )
+                    sums[k] += value*XRow[k*XColStride];
             }
-	}
+            T* YRow = &Y[i*YRowStride];
+            for( Int k=0; k<numRHS; ++k )
+                YRow[k*YColStride] = alpha*sums[k] + beta*YRow[k*YColStride];
+        }
     }
 }
 
-template<typename T,typename=DisableIf<IsBlasScalar<T>>>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
+// W := op(A(iBeg:iEnd,:)) X(iBeg:iEnd,:) + W, where W is a column-major
+// n x numRHS matrix with leading dimension ldW
+template<typename T,bool pattern,bool conjugate>
+void AccumulateCSRTrans
+( Int iBeg, Int iEnd, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   x,
-  T beta,
-        T*   y )
+  const T*   X, Int XRowStride, Int XColStride,
+        T*   W, Int WRowStride, Int WColStride )
 {
-    DEBUG_CSE
-    if( orientation == NORMAL )
+    for( Int i=iBeg; i<iEnd; ++i )
     {
-        for( Int i=0; i<m; ++i )
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        const T* XRow = &X[i*XRowStride];
+        for( Int e=eStart; e<eStop; ++e )
         {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
+            const T prod = alpha*Value<T,pattern,conjugate>(values,e);
+            T* WRow = &W[colIndices[e]*WRowStride];
+            for( Int k=0; k<numRHS; ++k )
+                WRow[k*WColStride] += prod*XRow[k*XColStride];
         }
     }
-    else
+}
+
+// Y := alpha op(A) X + beta Y, where op(A) is either A^T or A^H
+//
+// The scattered updates to Y would race if the rows of A were naively
+// distributed among threads, so each thread instead accumulates into a
+// private copy of Y for a contiguous set of rows with (roughly) equal numbers
+// of nonzeros, and the copies are then summed.
+template<typename T,bool pattern,bool conjugate>
+void MultiplyCSRTrans
+( Int m, Int n, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   X, Int XRowStride, Int XColStride,
+  T beta,
+        T*   Y, Int YRowStride, Int YColStride )
+{
+    DEBUG_CSE
+#ifdef EL_HYBRID
+    // Zeroing and reducing each private copy of Y costs O(n numRHS), which
+    // only pays off if each thread owns at least n nonzeros. This also bounds
+    // the workspace by numNonzeros*numRHS.
+    const Int numNonzeros = rowOffsets[m];
+    const Int numThreads =
+      Min( Int(omp_get_max_threads()), numNonzeros/Max(n,Int(1)) );
+    if( numThreads > 1 && m > numThreads )
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
+        const Int workSize = n*numRHS;
+        vector<T> work( numThreads*workSize, T(0) );
+
+        // The t'th thread begins at nonzero floor(t*numNonzeros/numThreads),
+        // which is evaluated without forming t*numNonzeros
+        const Int quotient = numNonzeros / numThreads;
+        const Int remainder = numNonzeros % numThreads;
+        auto firstRow = [&]( Int t )
+          {
+              const Int e = t*quotient + (t*remainder)/numThreads;
+              return Int
+                ( std::upper_bound( rowOffsets, rowOffsets+m, e ) -
+                  rowOffsets - 1 );
+          };
+        EL_PARALLEL_FOR
+        for( Int t=0; t<numThreads; ++t )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
-            }
+            const Int iBeg = firstRow( t );
+            const Int iEnd = ( t == numThreads-1 ? m : firstRow( t+1 ) );
+            AccumulateCSRTrans<T,pattern,conjugate>
+            ( iBeg, iEnd, numRHS, alpha, rowOffsets, colIndices, values,
+              X, XRowStride, XColStride, &work[t*workSize], 1, n );
         }
-        else
+
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
         {
-            for( Int i=0; i<m; ++i )
+            T* YRow = &Y[j*YRowStride];
+            for( Int k=0; k<numRHS; ++k )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
+                T sum = 0;
+                for( Int t=0; t<numThreads; ++t )
+                    sum += work[j+k*n+t*workSize];
+                YRow[k*YColStride] = beta*YRow[k*YColStride] + sum;
             }
         }
+        return;
     }
+#endif
+    for( Int j=0; j<n; ++j )
+        for( Int k=0; k<numRHS; ++k )
+            Y[j*YRowStride+k*YColStride] *= beta;
+    AccumulateCSRTrans<T,pattern,conjugate>
+    ( 0, m, numRHS, alpha, rowOffsets, colIndices, values,
+      X, XRowStride, XColStride, Y, YRowStride, YColStride );
 }
 
-template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
-void MultiplyCSR
+#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+bool MultiplyCSRMKL
 ( Orientation orientation,
   Int m, Int n,
   T alpha,
@@ -121,129 +211,30 @@ void MultiplyCSR
   T beta,
         T*   y )
 {
-    DEBUG_CSE
-#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
     char matDescrA[6];
     matDescrA[0] = 'G';
     matDescrA[3] = 'C';
     mkl::csrmv
-    ( orientation, m, n, alpha, matDescrA, 
+    ( orientation, m, n, alpha, matDescrA,
       values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
-#else
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
-            }
-        }
-    }
-#endif
+    return true;
 }
 
-template<typename T>
-void MultiplyCSR
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+bool MultiplyCSRMKL
 ( Orientation orientation,
-  Int m, Int n, Int numRHS,
+  Int m, Int n,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   x,
   T beta,
-        T*   Y, Int ldY )
-{
-    DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-    }
-}
+        T*   y )
+{ return false; }
+#endif
 
+// Y := alpha op(A) X + beta Y for an m x n CSR matrix A
 template<typename T>
 void MultiplyCSR
 ( Orientation orientation,
@@ -251,274 +242,222 @@ void MultiplyCSR
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   X, Int ldX,
+  const T*   values,
+  const T*   X, Int XRowStride, Int XColStride,
   T beta,
-        T*   Y, Int ldY )
+        T*   Y, Int YRowStride, Int YColStride )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, X, beta, Y );
+#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
+    if( numRHS == 1 && values != nullptr &&
+        XRowStride == 1 && YRowStride == 1 &&
+        MultiplyCSRMKL
+        ( orientation, m, n, alpha,
+          rowOffsets, colIndices, values, X, beta, Y ) )
         return;
-    }
-
+#endif
+    const bool pattern = ( values == nullptr );
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
+        if( pattern )
+            MultiplyCSRNormal<T,true>
+            ( m, nullptr, numRHS, alpha, rowOffsets, colIndices, values,
+              X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
+        else
+            MultiplyCSRNormal<T,false>
+            ( m, nullptr, numRHS, alpha, rowOffsets, colIndices, values,
+              X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
     }
+    else if( pattern )
+        MultiplyCSRTrans<T,true,false>
+        ( m, n, numRHS, alpha, rowOffsets, colIndices, values,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
+    else if( orientation == ADJOINT )
+        MultiplyCSRTrans<T,false,true>
+        ( m, n, numRHS, alpha, rowOffsets, colIndices, values,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
     else
-    {
-        for( Int k=0; k<numRHS; ++k )
-	{
-            for( Int j=0; j<n; ++j )
-	    {
-                Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	    {
-            	        for( Int k=0; k<numRHS; ++k ){
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX]; 
-			}	    
-            	    }
-            	}
-            }
-        }
-    }
+        MultiplyCSRTrans<T,false,false>
+        ( m, n, numRHS, alpha, rowOffsets, colIndices, values,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
 }
 
-template<typename T>
-void MultiplyCSRInterX
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
+// y := alpha A x + beta y for A with the BCSR structure of blockSize x
+// blockSize blocks, where the values are read from the CSR format (in which
+// the stored entries of each row of a block are contiguous). The explicit
+// zeros of partially-filled blocks are skipped so that, as with CSR, they
+// never multiply an infinite or NaN entry of x.
+template<typename T,Int blockSize>
+void MultiplyBCSR
+( Int numBlockRows,
   T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
+  const Int* blockOffsets,
+  const Int* blockColIndices,
+  const unsigned* blockMasks,
+  const Int* rowSources,
   const T*   values,
-  const T*   X,
+  const T*   x,
   T beta,
-        T*   Y, Int ldY )
+        T*   y )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
+    const unsigned fullMask = (1u << (blockSize*blockSize)) - 1;
+    const unsigned rowMask = (1u << blockSize) - 1;
+    EL_PARALLEL_FOR
+    for( Int iBlock=0; iBlock<numBlockRows; ++iBlock )
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
+        T sums[blockSize];
+        for( Int r=0; r<blockSize; ++r )
+            sums[r] = 0;
+        const Int indexStart = blockOffsets[iBlock];
+        const Int indexStop = blockOffsets[iBlock+1];
+        for( Int index=indexStart; index<indexStop; ++index )
         {
-            for( Int i=0; i<m; ++i )
+            const Int* sources = &rowSources[index*blockSize];
+            const T* xBlock = &x[blockColIndices[index]*blockSize];
+            const unsigned mask = blockMasks[index];
+            if( mask == fullMask )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
+                for( Int r=0; r<blockSize; ++r )
                 {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
+                    const T* row = &values[sources[r]];
+                    for( Int c=0; c<blockSize; ++c )
+                        sums[r] += row[c]*xBlock[c];
                 }
             }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+            else
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
+                for( Int r=0; r<blockSize; ++r )
                 {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
+                    const unsigned rMask = (mask >> (r*blockSize)) & rowMask;
+                    const T* row = &values[sources[r]];
+                    Int k = 0;
+                    for( Int c=0; c<blockSize; ++c )
+                        if( (rMask >> c) & 1u )
+                            sums[r] += row[k++]*xBlock[c];
                 }
             }
         }
+        T* yBlock = &y[iBlock*blockSize];
+        for( Int r=0; r<blockSize; ++r )
+            yBlock[r] = alpha*sums[r] + beta*yBlock[r];
     }
 }
 
-template<typename T>
-void MultiplyCSRInterY
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
+// y := alpha A x + beta y for A with the SELL-C-sigma structure, where the
+// column indices of each chunk of chunkSize sorted rows are stored
+// column-by-column and the values of each row are read from the CSR format.
+// The padding is discarded with a select rather than multiplied by zero,
+// since x may not be finite.
+template<typename T,Int chunkSize>
+void MultiplySELL
+( Int m,
   T alpha,
-  const Int* rowOffsets,
+  const Int* chunkOffsets,
   const Int* colIndices,
+  const Int* rowPerm,
+  const Int* rowLengths,
+  const Int* rowSources,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   x,
   T beta,
-        T*   Y )
+        T*   y )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
+    const Int numChunks = (m+chunkSize-1) / chunkSize;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
     {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
+        T sums[chunkSize];
+        for( Int r=0; r<chunkSize; ++r )
+            sums[r] = 0;
+        const Int* lengths = &rowLengths[chunk*chunkSize];
+        const Int* sources = &rowSources[chunk*chunkSize];
+        const Int indexStart = chunkOffsets[chunk];
+        const Int indexStop = chunkOffsets[chunk+1];
+        Int slot = 0;
+        for( Int index=indexStart; index<indexStop; index+=chunkSize, ++slot )
+            for( Int r=0; r<chunkSize; ++r )
+                if( slot < lengths[r] )
+                    sums[r] += values[sources[r]+slot]*x[colIndices[index+r]];
+        const Int rowStop = Min( chunkSize, m-chunk*chunkSize );
+        for( Int r=0; r<rowStop; ++r )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
+            T& eta = y[rowPerm[chunk*chunkSize+r]];
+            eta = alpha*sums[r] + beta*eta;
         }
     }
 }
 
+// y := alpha A x + beta y using the frozen layout of A, if it has one
 template<typename T>
-void MultiplyCSRInter
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
+bool MultiplyFrozen
+( Int m,
   T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X,
+  const SparseMultMeta<T>& meta,
+  const T* values,
+  const T* x,
   T beta,
-        T*   Y )
+        T* y )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
+    if( meta.layout == SPARSE_BCSR )
     {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
+        const Int numBlockRows = m / meta.blockSize;
+        const Int* offsets = meta.offsets.data();
+        const Int* colIndices = meta.colIndices.data();
+        const unsigned* masks = meta.blockMasks.data();
+        const Int* sources = meta.sources.data();
+        switch( meta.blockSize )
         {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
+        case 2:
+            MultiplyBCSR<T,2>
+            ( numBlockRows, alpha, offsets, colIndices, masks, sources,
+              values, x, beta, y );
+            return true;
+        case 3:
+            MultiplyBCSR<T,3>
+            ( numBlockRows, alpha, offsets, colIndices, masks, sources,
+              values, x, beta, y );
+            return true;
+        case 4:
+            MultiplyBCSR<T,4>
+            ( numBlockRows, alpha, offsets, colIndices, masks, sources,
+              values, x, beta, y );
+            return true;
+        default:
+            return false;
         }
     }
-    else
+    else if( meta.layout == SPARSE_SELL )
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
+        const Int* offsets = meta.offsets.data();
+        const Int* colIndices = meta.colIndices.data();
+        const Int* rowPerm = meta.rowPerm.data();
+        const Int* lengths = meta.rowLengths.data();
+        const Int* sources = meta.sources.data();
+        switch( meta.blockSize )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k]; 
-                }
-            }
+        case 4:
+            MultiplySELL<T,4>
+            ( m, alpha, offsets, colIndices, rowPerm, lengths, sources,
+              values, x, beta, y );
+            return true;
+        case 8:
+            MultiplySELL<T,8>
+            ( m, alpha, offsets, colIndices, rowPerm, lengths, sources,
+              values, x, beta, y );
+            return true;
+        case 16:
+            MultiplySELL<T,16>
+            ( m, alpha, offsets, colIndices, rowPerm, lengths, sources,
+              values, x, beta, y );
+            return true;
+        default:
+            return false;
         }
     }
+    return false;
 }
 
 } // anonymous namespace
@@ -534,13 +473,21 @@ void Multiply
       if( X.Width() != Y.Width() )
           LogicError("X and Y must have the same width");
     )
+    // Matrices with frozen sparsity are assumed to be multiplied repeatedly,
+    // which amortizes the conversion into a layout with fewer indices to
+    // stream or which vectorizes better
+    if( orientation == NORMAL && X.Width() == 1 && A.FrozenSparsity() &&
+        MultiplyFrozen
+        ( A.Height(), alpha, A.InitializeMultMeta(), A.LockedValueBuffer(),
+          X.LockedBuffer(), beta, Y.Buffer() ) )
+        return;
     MultiplyCSR
     ( orientation, A.Height(), A.Width(), X.Width(),
       alpha, A.LockedOffsetBuffer(),
              A.LockedTargetBuffer(),
              A.LockedValueBuffer(),
-             X.LockedBuffer(), X.LDim(),
-      beta,  Y.Buffer(),       Y.LDim() );
+             X.LockedBuffer(), 1, X.LDim(),
+      beta,  Y.Buffer(),       1, Y.LDim() );
 }
 
 template<typename T>
@@ -555,11 +502,12 @@ void Multiply
           LogicError("X and Y must have the same width");
     )
     MultiplyCSR
-    ( orientation, A.NumSources(), A.NumTargets(), X.Width(), 
-      alpha, A.LockedOffsetBuffer(), 
-             A.LockedTargetBuffer(), 
-             X.LockedBuffer(), X.LDim(),
-      beta,  Y.Buffer(), Y.LDim());
+    ( orientation, A.NumSources(), A.NumTargets(), X.Width(),
+      alpha, A.LockedOffsetBuffer(),
+             A.LockedTargetBuffer(),
+             static_cast<const T*>(nullptr),
+             X.LockedBuffer(), 1, X.LDim(),
+      beta,  Y.Buffer(),       1, Y.LDim() );
 }
 
 
@@ -584,32 +532,24 @@ void Multiply
     const bool time = false;
 
     mpi::Comm comm = A.Comm();
-    const int commSize = mpi::Size( comm );
     const int commRank = mpi::Rank( comm );
-    // TODO: Use sequential implementation if commSize = 1?
 
     Timer totalTimer, timer;
     if( time && commRank == 0 )
         totalTimer.Start();
 
-    // Y := beta Y
-    Y *= beta;
-
     A.InitializeMultMeta();
     const auto& meta = A.LockedDistGraph().multMeta;
-    // Convert the sizes and offsets to be compatible with the current width
     const Int b = X.Width();
-    vector<int> recvSizes=meta.recvSizes,
-                recvOffs=meta.recvOffs,
-                sendSizes=meta.sendSizes,
-                sendOffs=meta.sendOffs;
-    for( int q=0; q<commSize; ++q )
-    {
-        recvSizes[q] *= b;    
-        recvOffs[q] *= b;
-        sendSizes[q] *= b;
-        sendOffs[q] *= b;
-    }
+    const Int numSendInds = meta.sendInds.size();
+    const Int numRecvInds = meta.numRecvInds;
+
+    // Only the processes which share indices with this one take part in the
+    // (nonblocking) exchange, and the indices which this process shares with
+    // itself are copied directly. The buffers are local to each call so that
+    // concurrent products with the same (const) matrix do not share them.
+    vector<mpi::Request<T>> requests;
+    vector<T> sendVals, recvVals;
 
     if( orientation == NORMAL )
     {
@@ -618,39 +558,57 @@ void Multiply
         if( A.Width() != X.Height() )
             LogicError("The width of A must match the height of X");
 
-        // Pack the send values
-        const Int numSendInds = meta.sendInds.size();
-        const Int firstLocalRow = X.FirstLocalRow();
-        vector<T> sendVals;
         FastResize( sendVals, numSendInds*b );
+        FastResize( recvVals, numRecvInds*b );
+
+        // Pack and send the rows of X requested by each process
+        const Int firstLocalRow = X.FirstLocalRow();
         const T* XBuffer = X.LockedMatrix().LockedBuffer();
         const Int ldX = X.LockedMatrix().LDim();
-        for( Int s=0; s<numSendInds; ++s )
-        {
-            const Int i = meta.sendInds[s];
-            const Int iLoc = i - firstLocalRow;
-            for( Int t=0; t<b; ++t )
-                sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
-        }
+        auto pack =
+          [&]( int q, T* buf )
+          {
+              const Int sendOff = meta.sendOffs[q];
+              const Int sendSize = meta.sendSizes[q];
+              for( Int s=0; s<sendSize; ++s )
+              {
+                  const Int iLoc = meta.sendInds[sendOff+s] - firstLocalRow;
+                  for( Int t=0; t<b; ++t )
+                      buf[s*b+t] = XBuffer[iLoc+t*ldX];
+              }
+          };
+        for( const int q : meta.plan.sendRanks )
+            pack( q, sendVals.data()+meta.sendOffs[q]*b );
+        mpi::INeighborAllToAll
+        ( sendVals.data(), recvVals.data(), b, meta.plan, comm, requests );
+        pack( commRank, recvVals.data()+meta.recvOffs[commRank]*b );
+
+        // Form the rows of y := alpha A x + beta y which only depend upon
+        // the local rows of X while the remaining rows are in transit
+        if( time && commRank == 0 )
+            timer.Start();
+        MultiplyCSRNormal<T,false>
+        ( meta.interiorSources.size(), meta.interiorSources.data(), b,
+          alpha, A.LockedOffsetBuffer(),
+                 meta.colOffs.data(),
+                 A.LockedValueBuffer(),
+                 recvVals.data(), b, 1,
+          beta,  Y.Matrix().Buffer(), 1, Y.Matrix().LDim() );
+        if( time && commRank == 0 )
+            Output("  Interior multiply time: ",timer.Stop());
 
-        // Now send them
-        vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
-     
-        // Perform the local multiply-accumulate, y := alpha A x + y
+        mpi::WaitAll( requests.size(), requests.data() );
         if( time && commRank == 0 )
             timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(), 
+        MultiplyCSRNormal<T,false>
+        ( meta.boundarySources.size(), meta.boundarySources.data(), b,
+          alpha, A.LockedOffsetBuffer(),
                  meta.colOffs.data(),
                  A.LockedValueBuffer(),
-                 recvVals.data(), 
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+                 recvVals.data(), b, 1,
+          beta,  Y.Matrix().Buffer(), 1, Y.Matrix().LDim() );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+            Output("  Boundary multiply time: ",timer.Stop());
     }
     else
     {
@@ -659,39 +617,48 @@ void Multiply
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
 
-        // Form and pack the updates to Y
+        // Form and send the updates to Y, where the roles of the send and
+        // recv indices are reversed
         if( time && commRank == 0 )
             timer.Start();
-        vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
+        sendVals.assign( numRecvInds*b, T(0) );
+        MultiplyCSR
+        ( orientation, A.LocalHeight(), numRecvInds, b,
           alpha, A.LockedOffsetBuffer(),
                  meta.colOffs.data(),
                  A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
+                 X.LockedMatrix().LockedBuffer(), 1, X.LockedMatrix().LDim(),
+          T(1),  sendVals.data(), b, 1 );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
-
-        // Inject the updates to Y into the network
-        const Int numRecvInds = meta.sendInds.size();
-        vector<T> recvVals;
-        FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), comm );
-     
-        // Accumulate the received indices onto Y
+            Output("  Local multiply time: ",timer.Stop());
+        FastResize( recvVals, numSendInds*b );
+        mpi::INeighborAllToAll
+        ( sendVals.data(), recvVals.data(), b, meta.adjointPlan, comm,
+          requests );
+
+        // Accumulate the updates from this process while the others are in
+        // transit
+        Y *= beta;
         const Int firstLocalRow = Y.FirstLocalRow();
-        T* YBuffer = Y.Matrix().Buffer(); 
+        T* YBuffer = Y.Matrix().Buffer();
         const Int ldY = Y.Matrix().LDim();
-        for( Int s=0; s<numRecvInds; ++s )
-        {
-            const Int i = meta.sendInds[s];
-            const Int iLoc = i - firstLocalRow;
-            for( Int t=0; t<b; ++t )
-                YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
-        }
+        auto accumulate =
+          [&]( int q, const T* buf )
+          {
+              const Int recvOff = meta.sendOffs[q];
+              const Int recvSize = meta.sendSizes[q];
+              for( Int s=0; s<recvSize; ++s )
+              {
+                  const Int iLoc = meta.sendInds[recvOff+s] - firstLocalRow;
+                  for( Int t=0; t<b; ++t )
+                      YBuffer[iLoc+t*ldY] += buf[s*b+t];
+              }
+          };
+        accumulate( commRank, sendVals.data()+meta.recvOffs[commRank]*b );
+
+        mpi::WaitAll( requests.size(), requests.data() );
+        for( const int q : meta.adjointPlan.recvRanks )
+            accumulate( q, recvVals.data()+meta.sendOffs[q]*b );
     }
     if( time && commRank == 0 )
         Output("Multiply total time: ",totalTimer.Stop());
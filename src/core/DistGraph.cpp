@@ -83,8 +83,12 @@ DistGraph::DistGraph( const DistGraph& graph )
 DistGraph::~DistGraph()
 { 
     if( !mpi::Finalized() )
+    {
+        // Free any graph communicators derived from comm_ before comm_
+        multMeta.Clear();
         if( comm_ != mpi::COMM_WORLD )
             mpi::Free( comm_ );
+    }
 } 
 
 // Assignment and reconfiguration
@@ -215,6 +219,7 @@ void DistGraph::SetComm( mpi::Comm comm )
     if( comm == comm_ )
         return;
 
+    multMeta.Clear();
     if( comm_ != mpi::COMM_WORLD )
         mpi::Free( comm_ );
     if( comm == mpi::COMM_WORLD )
@@ -748,6 +753,42 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
       meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
       comm );
 
+    // Only exchange with the other processes which share at least one index,
+    // as the indices shared with this process can be copied directly
+    mpi::BuildNeighborPlan
+    ( meta.sendSizes, meta.sendOffs, meta.recvSizes, meta.recvOffs,
+      meta.plan, comm, false );
+    mpi::BuildNeighborPlan
+    ( meta.recvSizes, meta.recvOffs, meta.sendSizes, meta.sendOffs,
+      meta.adjointPlan, comm, false );
+    const int commRank = mpi::Rank( comm );
+
+    // Split the local sources based upon whether they only connect to targets
+    // which this process owns
+    const Int localOffBeg = meta.recvOffs[commRank];
+    const Int localOffEnd = localOffBeg + meta.recvSizes[commRank];
+    const Int numLocalSources = NumLocalSources();
+    const Int* offsetBuffer = LockedOffsetBuffer();
+    meta.interiorSources.clear();
+    meta.boundarySources.clear();
+    for( Int iLoc=0; iLoc<numLocalSources; ++iLoc )
+    {
+        bool interior = true;
+        for( Int e=offsetBuffer[iLoc]; e<offsetBuffer[iLoc+1]; ++e )
+        {
+            const Int colOff = meta.colOffs[e];
+            if( colOff < localOffBeg || colOff >= localOffEnd )
+            {
+                interior = false;
+                break;
+            }
+        }
+        if( interior )
+            meta.interiorSources.push_back( iLoc );
+        else
+            meta.boundarySources.push_back( iLoc );
+    }
+
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
 
@@ -9,6 +9,10 @@
 */
 #include <El-lite.hpp>
 
+#if defined(__unix__) || defined(__APPLE__)
+# include <unistd.h>
+#endif
+
 namespace El {
 
 Grid* Grid::defaultGrid = 0;
@@ -45,7 +49,7 @@ int Grid::FindFactor( int p ) EL_NO_EXCEPT
 }
 
 Grid::Grid( mpi::Comm comm, GridOrder order )
-: haveViewers_(false), order_(order)
+: haveViewers_(false), order_(order), freeMemoryPerProcess_(0)
 {
     DEBUG_CSE
 
@@ -63,7 +67,7 @@ Grid::Grid( mpi::Comm comm, GridOrder order )
 }
 
 Grid::Grid( mpi::Comm comm, int height, GridOrder order )
-: haveViewers_(false), order_(order)
+: haveViewers_(false), order_(order), freeMemoryPerProcess_(0)
 {
     DEBUG_CSE
 
@@ -285,7 +289,7 @@ mpi::Comm Grid::Comm() const EL_NO_EXCEPT
 
 // Currently forces a columnMajor absolute rank on the grid
 Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
-: haveViewers_(true), order_(order)
+: haveViewers_(true), order_(order), freeMemoryPerProcess_(0)
 {
     DEBUG_CSE
 
@@ -385,6 +389,33 @@ int Grid::CoordsToVC
 int Grid::VCToViewing( int vcRank ) const EL_NO_EXCEPT
 { return vcToViewing_[vcRank]; }
 
+double Grid::FreeMemoryPerProcess() const
+{
+    DEBUG_CSE
+    if( freeMemoryPerProcess_ != 0 )
+        return freeMemoryPerProcess_;
+
+    double freeBytes = double(1) * (1 << 30);
+#if defined(_SC_AVPHYS_PAGES) && defined(_SC_PAGESIZE)
+    // Count the processes which share our node by hashing the hostnames
+    char hostname[256] = { 0 };
+    gethostname( hostname, sizeof(hostname)-1 );
+    const unsigned long hostHash = std::hash<string>()( string(hostname) );
+    vector<unsigned long> hostHashes( Size() );
+    mpi::AllGather( &hostHash, 1, hostHashes.data(), 1, Comm() );
+    const Int numLocalProcs =
+      std::count( hostHashes.begin(), hostHashes.end(), hostHash );
+
+    const double numPages = sysconf( _SC_AVPHYS_PAGES );
+    const double pageSize = sysconf( _SC_PAGESIZE );
+    if( numPages > 0 && pageSize > 0 )
+        freeBytes = numPages*pageSize / numLocalProcs;
+#endif
+    // Every process must agree on the result
+    freeMemoryPerProcess_ = mpi::AllReduce( freeBytes, mpi::MIN, Comm() );
+    return freeMemoryPerProcess_;
+}
+
 mpi::Group Grid::OwningGroup() const EL_NO_EXCEPT { return owningGroup_; }
 mpi::Comm Grid::OwningComm()  const EL_NO_EXCEPT { return owningComm_; }
 mpi::Comm Grid::ViewingComm() const EL_NO_EXCEPT { return viewingComm_; }
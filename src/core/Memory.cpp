@@ -0,0 +1,269 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+namespace {
+
+using El::MemoryStats;
+
+// Size class k holds idle blocks of at least 2^k bytes
+const int minSizeClass = 6;
+const int numSizeClasses = 8*sizeof(size_t);
+
+// The mode and alignment are atomic so that they can be read without taking
+// the lock, which is only needed to manipulate the pools
+std::mutex poolMutex;
+std::atomic<El::MemoryMode> memoryMode(El::SYSTEM_MEMORY_MODE);
+std::atomic<size_t> memoryAlignment(64);
+size_t maxPooledBytes = size_t(1) << 30;
+size_t pooledBytes = 0;
+std::vector<void*> pools[numSizeClasses];
+
+// The smallest k such that 2^k >= numBytes
+int CeilSizeClass( size_t numBytes )
+{
+    int k = minSizeClass;
+    while( k < numSizeClasses-1 && (size_t(1) << k) < numBytes )
+        ++k;
+    return k;
+}
+
+// The largest k such that 2^k <= numBytes
+int FloorSizeClass( size_t numBytes )
+{
+    int k = 0;
+    while( k < numSizeClasses-1 && (size_t(1) << (k+1)) <= numBytes )
+        ++k;
+    return k;
+}
+
+void* SystemAllocate( size_t numBytes, size_t alignment )
+{
+    // posix_memalign requires a multiple of the pointer size
+    alignment = std::max( alignment, sizeof(void*) );
+    void* ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc( numBytes, alignment );
+#else
+    if( posix_memalign( &ptr, alignment, numBytes ) != 0 )
+        ptr = nullptr;
+#endif
+    if( ptr == nullptr )
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void SystemFree( void* ptr )
+{
+#ifdef _WIN32
+    _aligned_free( ptr );
+#else
+    std::free( ptr );
+#endif
+}
+
+bool Aligned( const void* ptr, size_t alignment )
+{ return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0; }
+
+bool Pooling()
+{
+    return ::memoryMode.load(std::memory_order_relaxed) ==
+           El::POOLED_MEMORY_MODE;
+}
+
+void RecordAllocation( size_t capacity, El::memory::AtomicStats& stats )
+{
+    ++stats.numAllocs;
+    const size_t numBytesLive = (stats.numBytesLive += capacity);
+    size_t peakBytesLive = stats.peakBytesLive.load();
+    while( peakBytesLive < numBytesLive &&
+           !stats.peakBytesLive.compare_exchange_weak
+            ( peakBytesLive, numBytesLive ) );
+}
+
+void ReleasePools()
+{
+    for( int k=0; k<numSizeClasses; ++k )
+    {
+        for( void* ptr : pools[k] )
+            SystemFree( ptr );
+        pools[k].clear();
+    }
+    pooledBytes = 0;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void SetMemoryMode( MemoryMode mode )
+{
+    std::lock_guard<std::mutex> guard(::poolMutex);
+    ::memoryMode = mode;
+    if( mode == SYSTEM_MEMORY_MODE )
+        ReleasePools();
+}
+
+MemoryMode GetMemoryMode()
+{ return ::memoryMode.load(); }
+
+void SetMemoryAlignment( size_t alignment )
+{
+    if( alignment == 0 || (alignment & (alignment-1)) != 0 )
+        LogicError("Memory alignment must be a power of two");
+    ::memoryAlignment = alignment;
+}
+
+size_t MemoryAlignment()
+{ return ::memoryAlignment.load(std::memory_order_relaxed); }
+
+void SetMaxPooledBytes( size_t maxPooledBytes )
+{
+    std::lock_guard<std::mutex> guard(::poolMutex);
+    ::maxPooledBytes = maxPooledBytes;
+    if( ::pooledBytes > maxPooledBytes )
+        ReleasePools();
+}
+
+size_t MaxPooledBytes()
+{
+    std::lock_guard<std::mutex> guard(::poolMutex);
+    return ::maxPooledBytes;
+}
+
+size_t PooledBytes()
+{
+    std::lock_guard<std::mutex> guard(::poolMutex);
+    return ::pooledBytes;
+}
+
+void ReleasePooledMemory()
+{
+    std::lock_guard<std::mutex> guard(::poolMutex);
+    ReleasePools();
+}
+
+template<typename G>
+MemoryStats GetMemoryStats()
+{
+    const memory::AtomicStats& counters = memory::Stats<G>();
+    MemoryStats stats;
+    stats.numAllocs = counters.numAllocs;
+    stats.numFrees = counters.numFrees;
+    stats.numBytesLive = counters.numBytesLive;
+    stats.peakBytesLive = counters.peakBytesLive;
+    stats.numPoolHits = counters.numPoolHits;
+    stats.numPoolMisses = counters.numPoolMisses;
+    return stats;
+}
+
+template<typename G>
+void ResetMemoryStats()
+{
+    memory::AtomicStats& stats = memory::Stats<G>();
+    // The live bytes are still owned by existing buffers
+    stats.numAllocs = 0;
+    stats.numFrees = 0;
+    stats.peakBytesLive = stats.numBytesLive.load();
+    stats.numPoolHits = 0;
+    stats.numPoolMisses = 0;
+}
+
+void PrintMemoryStats
+( const MemoryStats& stats, const string& label, ostream& os )
+{
+    os << label << ":\n"
+       << "  allocations: " << stats.numAllocs << "\n"
+       << "  frees:       " << stats.numFrees << "\n"
+       << "  live bytes:  " << stats.numBytesLive << "\n"
+       << "  peak bytes:  " << stats.peakBytesLive << "\n"
+       << "  pool hits:   " << stats.numPoolHits << "\n"
+       << "  pool misses: " << stats.numPoolMisses << endl;
+}
+
+namespace memory {
+
+void* Allocate
+( size_t numBytes, size_t alignment, size_t& capacity, AtomicStats& stats )
+{
+    if( Pooling() )
+    {
+        std::lock_guard<std::mutex> guard(::poolMutex);
+        // The mode can only change while the lock is held
+        if( Pooling() )
+        {
+            void* ptr = nullptr;
+            const int k = CeilSizeClass( numBytes );
+            capacity = size_t(1) << k;
+            // Idle blocks were aligned for their previous owner, so they can
+            // only be reused when that alignment suffices
+            auto& pool = ::pools[k];
+            auto it = std::find_if
+              ( pool.rbegin(), pool.rend(),
+                [&]( void* block ) { return Aligned( block, alignment ); } );
+            if( it != pool.rend() )
+            {
+                ptr = *it;
+                pool.erase( std::next(it).base() );
+                ::pooledBytes -= capacity;
+                ++stats.numPoolHits;
+            }
+            else
+            {
+                ptr = SystemAllocate( capacity, alignment );
+                ++stats.numPoolMisses;
+            }
+            RecordAllocation( capacity, stats );
+            return ptr;
+        }
+    }
+    capacity = numBytes;
+    void* ptr = SystemAllocate( capacity, alignment );
+    RecordAllocation( capacity, stats );
+    return ptr;
+}
+
+void Free( void* ptr, size_t capacity, AtomicStats& stats )
+{
+    ++stats.numFrees;
+    stats.numBytesLive -= capacity;
+    // Blocks smaller than the minimum size class could never be reused
+    if( Pooling() && capacity >= (size_t(1) << minSizeClass) )
+    {
+        std::lock_guard<std::mutex> guard(::poolMutex);
+        if( Pooling() && ::pooledBytes+capacity <= ::maxPooledBytes )
+        {
+            // Blocks acquired in system mode need not have a power-of-two
+            // size, so we file them under the largest class they can serve
+            const int k = FloorSizeClass( capacity );
+            ::pools[k].push_back( ptr );
+            ::pooledBytes += size_t(1) << k;
+            return;
+        }
+    }
+    SystemFree( ptr );
+}
+
+} // namespace memory
+
+#define PROTO(T) \
+  template MemoryStats GetMemoryStats<T>(); \
+  template void ResetMemoryStats<T>();
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -232,6 +232,9 @@ void Finalize()
 #endif
 
         FinalizeRandom();
+
+        // Return the pooled blocks before any static destructors can run
+        SetMemoryMode( SYSTEM_MEMORY_MODE );
     }
 
     DEBUG_ONLY( CloseLog() )
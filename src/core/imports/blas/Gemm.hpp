@@ -45,7 +45,7 @@ namespace El {
 namespace blas {
 
 template<typename T>
-void Gemm
+void NaiveGemm
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k,
   const T& alpha,
@@ -260,6 +260,301 @@ void Gemm
         }
     }
 }
+namespace gemm {
+
+// Register (MR x NR) and cache (MC x KC x NC) blocksizes for the packed
+// implementation used for datatypes not supported by BLAS
+template<typename T>
+struct Blocking
+{
+    static const BlasInt MR=4, NR=4;
+    static const BlasInt MC=64, KC=128, NC=2048;
+};
+
+// Pack the mc x kc matrix op(A) into micro-panels of MR rows, each of which is
+// stored column-by-column, padding the last micro-panel with zeros
+template<typename T>
+void PackA
+( char transA, BlasInt mc, BlasInt kc,
+  const T* A, BlasInt ALDim, T* APack )
+{
+    const BlasInt MR = Blocking<T>::MR;
+    const bool normal = ( std::toupper(transA) == 'N' );
+    const bool conjugate = ( std::toupper(transA) == 'C' );
+    for( BlasInt i0=0; i0<mc; i0+=MR )
+    {
+        const BlasInt mr = Min(MR,mc-i0);
+        T* panel = &APack[i0*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<mr; ++i )
+            {
+                const T& alpha =
+                  ( normal ? A[(i0+i)+l*ALDim] : A[l+(i0+i)*ALDim] );
+                if( conjugate )
+                    Conj( alpha, panel[i+l*MR] );
+                else
+                    panel[i+l*MR] = alpha;
+            }
+            for( BlasInt i=mr; i<MR; ++i )
+                panel[i+l*MR] = 0;
+        }
+    }
+}
+
+// Pack the kc x nc matrix alpha op(B) into micro-panels of NR columns, each of
+// which is stored row-by-row, padding the last micro-panel with zeros
+template<typename T>
+void PackB
+( char transB, BlasInt kc, BlasInt nc,
+  const T& alpha, const T* B, BlasInt BLDim, T* BPack )
+{
+    const BlasInt NR = Blocking<T>::NR;
+    const bool normal = ( std::toupper(transB) == 'N' );
+    const bool conjugate = ( std::toupper(transB) == 'C' );
+    const BlasInt numPanels = (nc+NR-1)/NR;
+    EL_PARALLEL_FOR
+    for( BlasInt panelIndex=0; panelIndex<numPanels; ++panelIndex )
+    {
+        const BlasInt j0 = panelIndex*NR;
+        const BlasInt nr = Min(NR,nc-j0);
+        T* panel = &BPack[j0*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<nr; ++j )
+            {
+                const T& beta =
+                  ( normal ? B[l+(j0+j)*BLDim] : B[(j0+j)+l*BLDim] );
+                if( conjugate )
+                    Conj( beta, panel[j+l*NR] );
+                else
+                    panel[j+l*NR] = beta;
+                panel[j+l*NR] *= alpha;
+            }
+            for( BlasInt j=nr; j<NR; ++j )
+                panel[j+l*NR] = 0;
+        }
+    }
+}
+
+// Form the MR x NR tile AB := APanel BPanel
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void MicroKernel
+( BlasInt kc, const T* APanel, const T* BPanel, T* AB, T& delta )
+{
+    const BlasInt MR = Blocking<T>::MR;
+    const BlasInt NR = Blocking<T>::NR;
+    // Accumulate within a local tile so that it can be held in registers
+    T ABLoc[MR*NR];
+    for( BlasInt t=0; t<MR*NR; ++t )
+        ABLoc[t] = 0;
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const T* a = &APanel[l*MR];
+        const T* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+            for( BlasInt i=0; i<MR; ++i )
+                ABLoc[i+j*MR] += a[i]*b[j];
+    }
+    for( BlasInt t=0; t<MR*NR; ++t )
+        AB[t] = ABLoc[t];
+}
+
+// Form the MR x NR tile AB := APanel BPanel using the scratch value 'delta'
+// so that no BigInt/BigFloat temporaries are constructed
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void MicroKernel
+( BlasInt kc, const T* APanel, const T* BPanel, T* AB, T& delta )
+{
+    const BlasInt MR = Blocking<T>::MR;
+    const BlasInt NR = Blocking<T>::NR;
+    for( BlasInt t=0; t<MR*NR; ++t )
+        AB[t] = 0;
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const T* a = &APanel[l*MR];
+        const T* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            for( BlasInt i=0; i<MR; ++i )
+            {
+                delta = a[i];
+                delta *= b[j];
+                AB[i+j*MR] += delta;
+            }
+        }
+    }
+}
+
+// C += APack BPack, where APack is mc x kc and BPack is kc x nc
+template<typename T>
+void MacroKernel
+( BlasInt mc, BlasInt nc, BlasInt kc,
+  const T* APack, const T* BPack, T* C, BlasInt CLDim )
+{
+    const BlasInt MR = Blocking<T>::MR;
+    const BlasInt NR = Blocking<T>::NR;
+    // Avoid constructing BigInt/BigFloat temporaries within the inner loops
+    vector<T> AB( MR*NR );
+    T delta;
+    for( BlasInt j0=0; j0<nc; j0+=NR )
+    {
+        const BlasInt nr = Min(NR,nc-j0);
+        for( BlasInt i0=0; i0<mc; i0+=MR )
+        {
+            const BlasInt mr = Min(MR,mc-i0);
+            MicroKernel( kc, &APack[i0*kc], &BPack[j0*kc], AB.data(), delta );
+            for( BlasInt j=0; j<nr; ++j )
+                for( BlasInt i=0; i<mr; ++i )
+                    C[(i0+i)+(j0+j)*CLDim] += AB[i+j*MR];
+        }
+    }
+}
+
+// C := alpha op(A) op(B) + C via packed panels in the style of GotoBLAS:
+// each KC x NC panel of op(B) is packed once and shared, while each
+// MC x KC block of op(A) is packed by the thread which owns it.
+template<typename T>
+void Blocked
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt MR = Blocking<T>::MR;
+    const BlasInt NR = Blocking<T>::NR;
+    const BlasInt MC = Blocking<T>::MC;
+    const BlasInt KC = Blocking<T>::KC;
+    const BlasInt NC = Blocking<T>::NC;
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+
+    const BlasInt kcMax = Min(KC,k);
+    const BlasInt ncMax = Min(NC,n);
+    const BlasInt numBlocksM = (m+MC-1)/MC;
+    const BlasInt mcPadded = ((Min(MC,m)+MR-1)/MR)*MR;
+    const BlasInt ncPadded = ((ncMax+NR-1)/NR)*NR;
+    vector<T> APack( numBlocksM*mcPadded*kcMax ), BPack( ncPadded*kcMax );
+
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+            const T* BBlock = ( normalB ? &B[pc+jc*BLDim] : &B[jc+pc*BLDim] );
+            PackB( transB, kc, nc, alpha, BBlock, BLDim, BPack.data() );
+
+            EL_PARALLEL_FOR
+            for( BlasInt blockM=0; blockM<numBlocksM; ++blockM )
+            {
+                const BlasInt ic = blockM*MC;
+                const BlasInt mc = Min(MC,m-ic);
+                const T* ABlock =
+                  ( normalA ? &A[ic+pc*ALDim] : &A[pc+ic*ALDim] );
+                T* APackBlock = &APack[blockM*mcPadded*kcMax];
+                PackA( transA, mc, kc, ABlock, ALDim, APackBlock );
+                MacroKernel
+                ( mc, nc, kc, APackBlock, BPack.data(),
+                  &C[ic+jc*CLDim], CLDim );
+            }
+        }
+    }
+}
+
+} // namespace gemm
+
+template<typename T>
+void PackedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    // Scale C
+    if( beta == T(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+
+    gemm::Blocked
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
+
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    // Packing is not worthwhile for matrix-vector-like products
+    if( m < gemm::Blocking<T>::MR || n < gemm::Blocking<T>::NR ||
+        k < gemm::Blocking<T>::MR )
+        NaiveGemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+    else
+        PackedGemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+
+#define EL_GEMM_PROTO(T) \
+  template void NaiveGemm \
+  ( char transA, char transB, \
+    BlasInt m, BlasInt n, BlasInt k, \
+    const T& alpha, \
+    const T* A, BlasInt ALDim, \
+    const T* B, BlasInt BLDim, \
+    const T& beta, \
+          T* C, BlasInt CLDim ); \
+  template void PackedGemm \
+  ( char transA, char transB, \
+    BlasInt m, BlasInt n, BlasInt k, \
+    const T& alpha, \
+    const T* A, BlasInt ALDim, \
+    const T* B, BlasInt BLDim, \
+    const T& beta, \
+          T* C, BlasInt CLDim );
+EL_GEMM_PROTO(Int)
+EL_GEMM_PROTO(float)
+EL_GEMM_PROTO(double)
+EL_GEMM_PROTO(scomplex)
+EL_GEMM_PROTO(dcomplex)
+#ifdef EL_HAVE_QD
+EL_GEMM_PROTO(DoubleDouble)
+EL_GEMM_PROTO(QuadDouble)
+EL_GEMM_PROTO(Complex<DoubleDouble>)
+EL_GEMM_PROTO(Complex<QuadDouble>)
+#endif
+#ifdef EL_HAVE_QUAD
+EL_GEMM_PROTO(Quad)
+EL_GEMM_PROTO(Complex<Quad>)
+#endif
+#ifdef EL_HAVE_MPC
+EL_GEMM_PROTO(BigInt)
+EL_GEMM_PROTO(BigFloat)
+EL_GEMM_PROTO(Complex<BigFloat>)
+#endif
+#undef EL_GEMM_PROTO
+
 template void Gemm
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k, 
@@ -60,8 +60,58 @@ void EL_BLAS(zsyr2k)
 namespace El {
 namespace blas {
 
+namespace syr2k {
+
+// C := alpha op(A) op(B)^{T/H} + alphaAdj op(B) op(A)^{T/H} + C, where
+// 'adjoint' is either 'T' or 'C', the diagonal blocks are formed by
+// 'diagUpdate', and the strictly triangular remainder by Gemm
+template<typename T,typename DiagUpdate>
+void Blocked
+( char uplo, char trans, char adjoint,
+  BlasInt n, BlasInt k,
+  const T& alpha, const T& alphaAdj,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim,
+  DiagUpdate diagUpdate )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    // The offsets of row i of op(A) and op(B)
+    auto opRowA = [&]( BlasInt i ) { return normal ? i : i*ALDim; };
+    auto opRowB = [&]( BlasInt i ) { return normal ? i : i*BLDim; };
+    const char transLeft = ( normal ? 'N' : adjoint );
+    const char transRight = ( normal ? adjoint : 'N' );
+    const BlasInt blocksize = syrk::blocksize;
+    for( BlasInt j0=0; j0<n; j0+=blocksize )
+    {
+        const BlasInt nb = Min(blocksize,n-j0);
+        const BlasInt j1 = j0 + nb;
+        diagUpdate( nb, &A[opRowA(j0)], &B[opRowB(j0)], &C[j0+j0*CLDim] );
+        const BlasInt i0 = ( lower ? j1 : 0 );
+        const BlasInt mb = ( lower ? n-j1 : j0 );
+        if( mb > 0 )
+        {
+            Gemm
+            ( transLeft, transRight, mb, nb, k,
+              alpha, &A[opRowA(i0)], ALDim,
+                     &B[opRowB(j0)], BLDim,
+              T(1),  &C[i0+j0*CLDim], CLDim );
+            Gemm
+            ( transLeft, transRight, mb, nb, k,
+              alphaAdj, &B[opRowB(i0)], BLDim,
+                        &A[opRowA(j0)], ALDim,
+              T(1),     &C[i0+j0*CLDim], CLDim );
+        }
+    }
+}
+
+} // namespace syr2k
+
+namespace her2k {
+
 template<typename T>
-void Her2k
+void Unblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const T& alpha,
@@ -199,6 +249,29 @@ void Her2k
         }
     }
 }
+
+} // namespace her2k
+
+template<typename T>
+void Her2k
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    syrk::ScaleTrapezoid( uplo, n, beta, C, CLDim );
+    syr2k::Blocked
+    ( uplo, trans, 'C', n, k, alpha, Conj(alpha),
+      A, ALDim, B, BLDim, C, CLDim,
+      [&]( BlasInt nb, const T* ADiag, const T* BDiag, T* CDiag )
+      { her2k::Unblocked
+        ( uplo, trans, nb, k, alpha, ADiag, ALDim, BDiag, BLDim,
+          Base<T>(1), CDiag, CLDim ); } );
+}
+
 template void Her2k
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
@@ -344,8 +417,10 @@ void Her2k
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
 
+namespace syr2k {
+
 template<typename T>
-void Syr2k
+void Unblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const T& alpha,
@@ -470,6 +545,29 @@ void Syr2k
         }
     }
 }
+
+} // namespace syr2k
+
+template<typename T>
+void Syr2k
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const T& alpha,
+  const T* A, BlasInt ALDim, 
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    syrk::ScaleTrapezoid( uplo, n, beta, C, CLDim );
+    syr2k::Blocked
+    ( uplo, trans, 'T', n, k, alpha, alpha,
+      A, ALDim, B, BLDim, C, CLDim,
+      [&]( BlasInt nb, const T* ADiag, const T* BDiag, T* CDiag )
+      { syr2k::Unblocked
+        ( uplo, trans, nb, k, alpha, ADiag, ALDim, BDiag, BLDim,
+          T(1), CDiag, CLDim ); } );
+}
+
 template void Syr2k
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
@@ -54,8 +54,76 @@ void EL_BLAS(zsyrk)
 namespace El {
 namespace blas {
 
+namespace syrk {
+
+// The order of the diagonal blocks of C formed by the unblocked kernels;
+// everything else is funneled through Gemm
+const BlasInt blocksize = 64;
+
+// Scale the 'uplo' triangle of C by beta
+template<typename T,typename S>
+void ScaleTrapezoid
+( char uplo, BlasInt n, const S& beta, T* C, BlasInt CLDim )
+{
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    if( beta == S(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != S(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
+                C[i+j*CLDim] *= beta;
+    }
+}
+
+// C := alpha op(A) op(A)^{T/H} + C, where 'adjoint' is either 'T' or 'C', the
+// diagonal blocks are formed by 'diagUpdate', and the strictly triangular
+// remainder is formed by one Gemm per block column
+template<typename T,typename DiagUpdate>
+void Blocked
+( char uplo, char trans, char adjoint,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+        T* C, BlasInt CLDim,
+  DiagUpdate diagUpdate )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    // The offset of row i of op(A)
+    auto opRow = [&]( BlasInt i ) { return normal ? i : i*ALDim; };
+    const char transA = ( normal ? 'N' : adjoint );
+    const char transB = ( normal ? adjoint : 'N' );
+    for( BlasInt j0=0; j0<n; j0+=blocksize )
+    {
+        const BlasInt nb = Min(blocksize,n-j0);
+        const BlasInt j1 = j0 + nb;
+        diagUpdate( nb, &A[opRow(j0)], &C[j0+j0*CLDim] );
+        if( lower && j1 < n )
+            Gemm
+            ( transA, transB, n-j1, nb, k,
+              alpha, &A[opRow(j1)], ALDim,
+                     &A[opRow(j0)], ALDim,
+              T(1),  &C[j1+j0*CLDim], CLDim );
+        else if( !lower && j0 > 0 )
+            Gemm
+            ( transA, transB, j0, nb, k,
+              alpha, A,             ALDim,
+                     &A[opRow(j0)], ALDim,
+              T(1),  &C[j0*CLDim],  CLDim );
+    }
+}
+
+} // namespace syrk
+
+namespace herk {
+
 template<typename T>
-void Herk
+void Unblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const Base<T>& alpha,
@@ -163,6 +231,27 @@ void Herk
         }
     }
 }
+
+} // namespace herk
+
+template<typename T>
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    syrk::ScaleTrapezoid( uplo, n, beta, C, CLDim );
+    syrk::Blocked
+    ( uplo, trans, 'C', n, k, T(alpha), A, ALDim, C, CLDim,
+      [&]( BlasInt nb, const T* ADiag, T* CDiag )
+      { herk::Unblocked
+        ( uplo, trans, nb, k, alpha, ADiag, ALDim, Base<T>(1),
+          CDiag, CLDim ); } );
+}
+
 template void Herk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
@@ -290,8 +379,10 @@ void Herk
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
 
+namespace syrk {
+
 template<typename T>
-void Syrk
+void Unblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const T& alpha,
@@ -399,6 +490,26 @@ void Syrk
         }
     }
 }
+
+} // namespace syrk
+
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const T& alpha,
+  const T* A, BlasInt ALDim, 
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    syrk::ScaleTrapezoid( uplo, n, beta, C, CLDim );
+    syrk::Blocked
+    ( uplo, trans, 'T', n, k, alpha, A, ALDim, C, CLDim,
+      [&]( BlasInt nb, const T* ADiag, T* CDiag )
+      { syrk::Unblocked
+        ( uplo, trans, nb, k, alpha, ADiag, ALDim, T(1), CDiag, CLDim ); } );
+}
+
 template void Syrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
@@ -37,26 +37,25 @@ void EL_BLAS(ztrmm)
 namespace El {
 namespace blas {
 
+namespace trmm {
+
+// The order of the triangular blocks handled by the unblocked kernel
+const BlasInt blocksize = 64;
+// The number of right-hand sides handled by each (threaded) unblocked call
+const BlasInt rhsBlocksize = 16;
+
+// Streams the triangular matrix through memory once per row/column of B,
+// which is only tolerable for the small diagonal blocks of Recursive
 template<typename T>
-void Trmm
+void Unblocked
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
-  const T& alpha,
   const T* A, BlasInt ALDim,
         T* B, BlasInt BLDim )
 {
     const bool onLeft = ( std::toupper(side) == 'L' );
     const bool conjugate = ( std::toupper(trans) == 'C' );
 
-    // Scale B
-    for( BlasInt j=0; j<n; ++j )
-        for( BlasInt i=0; i<m; ++i )
-            B[i+j*BLDim] *= alpha;
-
-    // TODO: Legitimate blocked implementations...it seems offensive to
-    //       repeatedly stream all of the triangular matrix through memory
-    //       for each row/column of B
-
     if( onLeft )
     {
         for( BlasInt j=0; j<n; ++j )
@@ -78,6 +77,130 @@ void Trmm
         }
     }
 }
+
+// Split the right-hand sides into independent chunks for the unblocked kernel
+template<typename T>
+void ParallelUnblocked
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const T* A, BlasInt ALDim,
+        T* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt numRHS = ( onLeft ? n : m );
+    const BlasInt numChunks = (numRHS+rhsBlocksize-1)/rhsBlocksize;
+    EL_PARALLEL_FOR
+    for( BlasInt chunk=0; chunk<numChunks; ++chunk )
+    {
+        const BlasInt s0 = chunk*rhsBlocksize;
+        const BlasInt sb = Min(rhsBlocksize,numRHS-s0);
+        if( onLeft )
+            Unblocked
+            ( side, uplo, trans, unit, m, sb, A, ALDim,
+              &B[s0*BLDim], BLDim );
+        else
+            Unblocked
+            ( side, uplo, trans, unit, sb, n, A, ALDim, &B[s0], BLDim );
+    }
+}
+
+// B := op(A) B or B := B op(A) by recursively halving the triangular matrix
+// so that the bulk of the work is performed by Gemm
+template<typename T>
+void Recursive
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const T* A, BlasInt ALDim,
+        T* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt dim = ( onLeft ? m : n );
+    if( dim <= blocksize )
+    {
+        ParallelUnblocked( side, uplo, trans, unit, m, n, A, ALDim, B, BLDim );
+        return;
+    }
+    // Whether op(A) is lower-triangular
+    const bool lowerOp = ( (std::toupper(uplo) == 'L') == normal );
+    const BlasInt dim1 = dim/2;
+    const BlasInt dim2 = dim - dim1;
+    const T* A22 = &A[dim1+dim1*ALDim];
+    // The offset of the off-diagonal block of op(A)
+    const BlasInt offOp =
+      ( lowerOp == normal ? dim1 : dim1*ALDim );
+
+    if( onLeft )
+    {
+        T* B2 = &B[dim1];
+        if( lowerOp )
+        {
+            // B2 := op(A22) B2 + op(A)_{2,1} B1, then B1 := op(A11) B1
+            Recursive
+            ( side, uplo, trans, unit, dim2, n, A22, ALDim, B2, BLDim );
+            Gemm
+            ( trans, 'N', dim2, n, dim1,
+              T(1), &A[offOp], ALDim, B, BLDim, T(1), B2, BLDim );
+            Recursive( side, uplo, trans, unit, dim1, n, A, ALDim, B, BLDim );
+        }
+        else
+        {
+            // B1 := op(A11) B1 + op(A)_{1,2} B2, then B2 := op(A22) B2
+            Recursive( side, uplo, trans, unit, dim1, n, A, ALDim, B, BLDim );
+            Gemm
+            ( trans, 'N', dim1, n, dim2,
+              T(1), &A[offOp], ALDim, B2, BLDim, T(1), B, BLDim );
+            Recursive
+            ( side, uplo, trans, unit, dim2, n, A22, ALDim, B2, BLDim );
+        }
+    }
+    else
+    {
+        T* B2 = &B[dim1*BLDim];
+        if( lowerOp )
+        {
+            // B1 := B1 op(A11) + B2 op(A)_{2,1}, then B2 := B2 op(A22)
+            Recursive( side, uplo, trans, unit, m, dim1, A, ALDim, B, BLDim );
+            Gemm
+            ( 'N', trans, m, dim1, dim2,
+              T(1), B2, BLDim, &A[offOp], ALDim, T(1), B, BLDim );
+            Recursive
+            ( side, uplo, trans, unit, m, dim2, A22, ALDim, B2, BLDim );
+        }
+        else
+        {
+            // B2 := B2 op(A22) + B1 op(A)_{1,2}, then B1 := B1 op(A11)
+            Recursive
+            ( side, uplo, trans, unit, m, dim2, A22, ALDim, B2, BLDim );
+            Gemm
+            ( 'N', trans, m, dim2, dim1,
+              T(1), B, BLDim, &A[offOp], ALDim, T(1), B2, BLDim );
+            Recursive( side, uplo, trans, unit, m, dim1, A, ALDim, B, BLDim );
+        }
+    }
+}
+
+} // namespace trmm
+
+template<typename T>
+void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+        T* B, BlasInt BLDim )
+{
+    // Scale B
+    if( alpha != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+    }
+
+    trmm::Recursive( side, uplo, trans, unit, m, n, A, ALDim, B, BLDim );
+}
+
 template void Trmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
@@ -37,11 +37,17 @@ void EL_BLAS(ztrsm)
 namespace El {
 namespace blas {
 
+namespace trsm {
+
+// The order of the triangular blocks handled by the unblocked kernel
+const BlasInt blocksize = 64;
+// The number of right-hand sides handled by each (threaded) unblocked call
+const BlasInt rhsBlocksize = 16;
+
 template<typename F>
-void Trsm
+void Unblocked
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
-  const F& alpha,
   const F* A, BlasInt ALDim,
         F* B, BlasInt BLDim )
 {
@@ -52,11 +58,6 @@ void Trsm
     const bool conjugate = ( std::toupper(trans) == 'C' );
     const bool unitDiag = ( std::toupper(unit) == 'U' );
 
-    // Scale B
-    for( BlasInt j=0; j<n; ++j )
-        for( BlasInt i=0; i<m; ++i )
-            B[i+j*BLDim] *= alpha;
-
     F alpha11, alpha11Conj;
     if( onLeft )
     {
@@ -293,6 +294,138 @@ void Trsm
         }
     }
 }
+
+// Split the right-hand sides into independent chunks for the unblocked kernel
+template<typename F>
+void ParallelUnblocked
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt numRHS = ( onLeft ? n : m );
+    const BlasInt numChunks = (numRHS+rhsBlocksize-1)/rhsBlocksize;
+    EL_PARALLEL_FOR
+    for( BlasInt chunk=0; chunk<numChunks; ++chunk )
+    {
+        const BlasInt s0 = chunk*rhsBlocksize;
+        const BlasInt sb = Min(rhsBlocksize,numRHS-s0);
+        if( onLeft )
+            Unblocked
+            ( side, uplo, trans, unit, m, sb, A, ALDim,
+              &B[s0*BLDim], BLDim );
+        else
+            Unblocked
+            ( side, uplo, trans, unit, sb, n, A, ALDim, &B[s0], BLDim );
+    }
+}
+
+// B := inv(op(A)) B or B := B inv(op(A)) by recursively halving the
+// triangular matrix so that the bulk of the work is performed by Gemm
+template<typename F>
+void Recursive
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt dim = ( onLeft ? m : n );
+    if( dim <= blocksize )
+    {
+        ParallelUnblocked( side, uplo, trans, unit, m, n, A, ALDim, B, BLDim );
+        return;
+    }
+    // Whether op(A) is lower-triangular
+    const bool lowerOp = ( (std::toupper(uplo) == 'L') == normal );
+    const BlasInt dim1 = dim/2;
+    const BlasInt dim2 = dim - dim1;
+    const F* A22 = &A[dim1+dim1*ALDim];
+    // The offset of the off-diagonal block of op(A)
+    const BlasInt offOp =
+      ( lowerOp == normal ? dim1 : dim1*ALDim );
+
+    if( onLeft )
+    {
+        F* B2 = &B[dim1];
+        if( lowerOp )
+        {
+            // B1 := inv(op(A11)) B1, B2 -= op(A)_{2,1} B1,
+            // B2 := inv(op(A22)) B2
+            Recursive
+            ( side, uplo, trans, unit, dim1, n, A, ALDim, B, BLDim );
+            Gemm
+            ( trans, 'N', dim2, n, dim1,
+              F(-1), &A[offOp], ALDim, B, BLDim, F(1), B2, BLDim );
+            Recursive
+            ( side, uplo, trans, unit, dim2, n, A22, ALDim, B2, BLDim );
+        }
+        else
+        {
+            // B2 := inv(op(A22)) B2, B1 -= op(A)_{1,2} B2,
+            // B1 := inv(op(A11)) B1
+            Recursive
+            ( side, uplo, trans, unit, dim2, n, A22, ALDim, B2, BLDim );
+            Gemm
+            ( trans, 'N', dim1, n, dim2,
+              F(-1), &A[offOp], ALDim, B2, BLDim, F(1), B, BLDim );
+            Recursive
+            ( side, uplo, trans, unit, dim1, n, A, ALDim, B, BLDim );
+        }
+    }
+    else
+    {
+        F* B2 = &B[dim1*BLDim];
+        if( lowerOp )
+        {
+            // B2 := B2 inv(op(A22)), B1 -= B2 op(A)_{2,1},
+            // B1 := B1 inv(op(A11))
+            Recursive
+            ( side, uplo, trans, unit, m, dim2, A22, ALDim, B2, BLDim );
+            Gemm
+            ( 'N', trans, m, dim1, dim2,
+              F(-1), B2, BLDim, &A[offOp], ALDim, F(1), B, BLDim );
+            Recursive
+            ( side, uplo, trans, unit, m, dim1, A, ALDim, B, BLDim );
+        }
+        else
+        {
+            // B1 := B1 inv(op(A11)), B2 -= B1 op(A)_{1,2},
+            // B2 := B2 inv(op(A22))
+            Recursive
+            ( side, uplo, trans, unit, m, dim1, A, ALDim, B, BLDim );
+            Gemm
+            ( 'N', trans, m, dim2, dim1,
+              F(-1), B, BLDim, &A[offOp], ALDim, F(1), B2, BLDim );
+            Recursive
+            ( side, uplo, trans, unit, m, dim2, A22, ALDim, B2, BLDim );
+        }
+    }
+}
+
+} // namespace trsm
+
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    // Scale B
+    if( alpha != F(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+    }
+
+    trsm::Recursive( side, uplo, trans, unit, m, n, A, ALDim, B, BLDim );
+}
+
 #ifdef EL_HAVE_QD
 template void Trsm
 ( char side, char uplo, char trans, char unit,
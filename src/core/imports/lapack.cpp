@@ -369,15 +369,35 @@ template void Copy
   const BigInt* A, BlasInt lda,
         BigInt* B, BlasInt ldb );
 template void Copy
-( char uplo, BlasInt m, BlasInt n, 
-  const BigFloat* A, BlasInt lda,
-        BigFloat* B, BlasInt ldb );
-template void Copy
 ( char uplo, BlasInt m, BlasInt n, 
   const Complex<BigFloat>* A, BlasInt lda,
         Complex<BigFloat>* B, BlasInt ldb );
 #endif
 
+#ifdef EL_HAVE_MPC
+// Each column of an arena-backed Matrix<BigFloat> stores its limbs
+// contiguously, so whole column segments can be copied with one memcpy
+void Copy
+( char uplo, BlasInt m, BlasInt n,
+  const BigFloat* A, BlasInt lda,
+        BigFloat* B, BlasInt ldb )
+{
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool upper = ( std::toupper(uplo) == 'U' );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = ( lower ? j : 0 );
+        const Int iEnd = ( upper ? Min(j+1,Int(m)) : Int(m) );
+        if( iBeg >= iEnd )
+            continue;
+        if( mpfr::CopyArenaRun( iEnd-iBeg, &A[iBeg+j*lda], &B[iBeg+j*ldb] ) )
+            continue;
+        for( Int i=iBeg; i<iEnd; ++i )
+            B[i+j*ldb] = A[i+j*lda];
+    }
+}
+#endif
+
 void Copy
 ( char uplo, BlasInt m, BlasInt n, 
   const float* A, BlasInt lda, float* B, BlasInt ldb )
@@ -13,9 +13,18 @@ namespace {
 
 size_t numLimbs;
 int numIntLimbs;
+std::atomic<bool> arenaMode(false);
 
 El::BigInt bigIntZero, bigIntOne, bigIntTwo;
 
+// Each arena slot is rounded up to a whole number of limbs so that every
+// entry's significand is suitably aligned
+size_t ArenaSlotBytes( mpfr_prec_t prec )
+{
+    const size_t limbBytes = sizeof(mp_limb_t);
+    return ((mpfr_custom_get_size(prec)+limbBytes-1)/limbBytes)*limbBytes;
+}
+
 } // anonymous namespace
 
 namespace El {
@@ -81,6 +90,57 @@ mpfr_rnd_t RoundingMode()
 Int BinaryToDecimalPrecision( mpfr_prec_t prec )
 { return Int(Floor(prec*std::log10(2.))); }
 
+void SetArenaMode( bool arenaMode )
+{ ::arenaMode = arenaMode; }
+
+bool ArenaMode()
+{ return ::arenaMode; }
+
+size_t ArenaBytes( size_t size )
+{
+    if( !::arenaMode )
+        return 0;
+    return size*ArenaSlotBytes(Precision());
+}
+
+void ConstructInArena( BigFloat* buffer, size_t size, void* arena )
+{
+    DEBUG_CSE
+    const mpfr_prec_t prec = Precision();
+    const size_t slotBytes = ArenaSlotBytes( prec );
+    byte* slab = static_cast<byte*>(arena);
+    for( size_t i=0; i<size; ++i )
+        new(&buffer[i])
+          BigFloat( reinterpret_cast<mp_limb_t*>(&slab[i*slotBytes]), prec );
+}
+
+bool CopyArenaRun( size_t size, const BigFloat* x, BigFloat* y )
+{
+    DEBUG_CSE
+    if( size == 0 || x == y )
+        return true;
+    const mpfr_prec_t prec = x[0].Precision();
+    const size_t numLimbs = x[0].NumLimbs();
+    const mp_limb_t* xLimbs = x[0].LockedPointer()->_mpfr_d;
+    mp_limb_t* yLimbs = y[0].Pointer()->_mpfr_d;
+    for( size_t i=0; i<size; ++i )
+    {
+        if( !x[i].InArena() || !y[i].InArena() ||
+            x[i].Precision() != prec || y[i].Precision() != prec ||
+            x[i].LockedPointer()->_mpfr_d != xLimbs+i*numLimbs ||
+            y[i].LockedPointer()->_mpfr_d != yLimbs+i*numLimbs )
+            return false;
+    }
+
+    std::memcpy( yLimbs, xLimbs, size*numLimbs*sizeof(mp_limb_t) );
+    for( size_t i=0; i<size; ++i )
+    {
+        y[i].Pointer()->_mpfr_sign = x[i].LockedPointer()->_mpfr_sign;
+        y[i].Pointer()->_mpfr_exp = x[i].LockedPointer()->_mpfr_exp;
+    }
+    return true;
+}
+
 } // namespace mpfr
 
 namespace mpc {
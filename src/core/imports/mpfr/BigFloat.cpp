@@ -39,13 +39,33 @@ mpfr_prec_t BigFloat::Precision() const
 
 void BigFloat::SetPrecision( mpfr_prec_t prec )
 {
-    mpfr_set_prec( mpfrFloat_, prec ); 
+    if( inArena_ )
+    {
+        // MPFR cannot reallocate limbs that it does not own, so we either
+        // reuse the existing slot or move into MPFR-managed storage
+        if( (prec-1) / GMP_NUMB_BITS + 1 <= mpfr_prec_t(numLimbs_) )
+        {
+            mpfr_custom_init_set
+            ( mpfrFloat_, MPFR_NAN_KIND, 0, prec,
+              mpfr_custom_get_significand(mpfrFloat_) );
+        }
+        else
+        {
+            mpfr_init2( mpfrFloat_, prec );
+            inArena_ = false;
+        }
+    }
+    else
+        mpfr_set_prec( mpfrFloat_, prec ); 
     SetNumLimbs( prec );
 }
 
 size_t BigFloat::NumLimbs() const
 { return numLimbs_; }
 
+bool BigFloat::InArena() const
+{ return inArena_; }
+
 BigFloat::BigFloat()
 {
     DEBUG_CSE
@@ -223,15 +243,33 @@ BigFloat::BigFloat( const std::string& str, int base, mpfr_prec_t prec )
 BigFloat::BigFloat( BigFloat&& a )
 {
     DEBUG_CSE
-    Pointer()->_mpfr_d = 0;
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( a.inArena_ )
+    {
+        // The limbs of 'a' cannot outlive its arena, so we must copy them
+        Init( a.Precision() );
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
+    else
+    {
+        Pointer()->_mpfr_d = 0;
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+}
+
+BigFloat::BigFloat( mp_limb_t* limbs, mpfr_prec_t prec )
+{
+    DEBUG_CSE
+    mpfr_custom_init( limbs, prec );
+    mpfr_custom_init_set( mpfrFloat_, MPFR_NAN_KIND, 0, prec, limbs );
+    SetNumLimbs( prec );
+    inArena_ = true;
 }
 
 BigFloat::~BigFloat()
 {
     DEBUG_CSE
-    if( Pointer()->_mpfr_d != 0 )
+    if( !inArena_ && Pointer()->_mpfr_d != 0 )
         mpfr_clear( Pointer() );
 }
 
@@ -395,8 +433,17 @@ BigFloat& BigFloat::operator=( const Quad& a )
 BigFloat& BigFloat::operator=( BigFloat&& a )
 {
     DEBUG_CSE
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( inArena_ || a.inArena_ )
+    {
+        // Swapping would hand arena-owned limbs to (or take them from) an
+        // object with an unrelated lifetime
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
+    else
+    {
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
     return *this;
 }
 
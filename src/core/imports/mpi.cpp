@@ -1422,6 +1422,63 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,typename>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename Real,typename>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+ #ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+ #else
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request )
+{
+    DEBUG_CSE
+    // Both the packed send and receive buffers would need to outlive this
+    // call, but a Request only holds one
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template<typename Real,typename>
 void AllGather
 ( const Real* sbuf, int sc,
@@ -2720,6 +2777,163 @@ EL_NO_RELEASE_EXCEPT
 #endif
 }
 
+NeighborPlan::NeighborPlan()
+: graphComm(COMM_NULL)
+{ }
+
+NeighborPlan::NeighborPlan( const NeighborPlan& plan )
+: sendRanks(plan.sendRanks), sendCounts(plan.sendCounts),
+  sendOffs(plan.sendOffs),
+  recvRanks(plan.recvRanks), recvCounts(plan.recvCounts),
+  recvOffs(plan.recvOffs),
+  graphComm(COMM_NULL)
+{ }
+
+NeighborPlan::~NeighborPlan()
+{
+    if( graphComm != COMM_NULL && !Finalized() )
+        Free( graphComm );
+}
+
+const NeighborPlan& NeighborPlan::operator=( const NeighborPlan& plan )
+{
+    if( this == &plan )
+        return *this;
+    Clear();
+    sendRanks = plan.sendRanks;
+    sendCounts = plan.sendCounts;
+    sendOffs = plan.sendOffs;
+    recvRanks = plan.recvRanks;
+    recvCounts = plan.recvCounts;
+    recvOffs = plan.recvOffs;
+    return *this;
+}
+
+void NeighborPlan::Clear()
+{
+    SwapClear( sendRanks );
+    SwapClear( sendCounts );
+    SwapClear( sendOffs );
+    SwapClear( recvRanks );
+    SwapClear( recvCounts );
+    SwapClear( recvOffs );
+    if( graphComm != COMM_NULL )
+        Free( graphComm );
+    graphComm = COMM_NULL;
+}
+
+void BuildNeighborPlan
+( const vector<int>& sendCounts, const vector<int>& sendOffs,
+  const vector<int>& recvCounts, const vector<int>& recvOffs,
+  NeighborPlan& plan, Comm comm, bool includeSelf, bool formGraphComm )
+{
+    DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    plan.Clear();
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank && !includeSelf )
+            continue;
+        if( sendCounts[q] != 0 )
+        {
+            plan.sendRanks.push_back( q );
+            plan.sendCounts.push_back( sendCounts[q] );
+            plan.sendOffs.push_back( sendOffs[q] );
+        }
+        if( recvCounts[q] != 0 )
+        {
+            plan.recvRanks.push_back( q );
+            plan.recvCounts.push_back( recvCounts[q] );
+            plan.recvOffs.push_back( recvOffs[q] );
+        }
+    }
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    if( formGraphComm )
+    {
+        // Ranks are not reordered so that the neighbors keep their ranks
+        SafeMpi
+        ( MPI_Dist_graph_create_adjacent
+          ( comm.comm,
+            int(plan.recvRanks.size()), plan.recvRanks.data(),
+            MPI_UNWEIGHTED,
+            int(plan.sendRanks.size()), plan.sendRanks.data(),
+            MPI_UNWEIGHTED,
+            MPI_INFO_NULL, 0, &plan.graphComm.comm ) );
+    }
+#endif
+}
+
+template<typename T>
+void INeighborAllToAll
+( const T* sendBuf, T* recvBuf, int width,
+  const NeighborPlan& plan, Comm comm,
+  vector<Request<T>>& requests )
+{
+    DEBUG_CSE
+    const int numSends = plan.sendRanks.size();
+    const int numRecvs = plan.recvRanks.size();
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    // Datatypes which do not require serialization are exchanged using a
+    // contiguous datatype of width entries so that the counts and offsets
+    // of the plan can be used without being scaled (and overflowing)
+    if( plan.graphComm != COMM_NULL && IsPacked<Base<T>>::value )
+    {
+        Datatype rowType;
+        SafeMpi( MPI_Type_contiguous( width, TypeMap<T>(), &rowType ) );
+        SafeMpi( MPI_Type_commit( &rowType ) );
+        requests.resize( 1 );
+        SafeMpi
+        ( MPI_Ineighbor_alltoallv
+          ( const_cast<T*>(sendBuf),
+            const_cast<int*>(plan.sendCounts.data()),
+            const_cast<int*>(plan.sendOffs.data()), rowType,
+            recvBuf,
+            const_cast<int*>(plan.recvCounts.data()),
+            const_cast<int*>(plan.recvOffs.data()), rowType,
+            plan.graphComm.comm, &requests[0].backend ) );
+        // The datatype is only marked for deallocation until the pending
+        // exchange completes
+        SafeMpi( MPI_Type_free( &rowType ) );
+        return;
+    }
+#endif
+    // The offsets and counts are scaled by the width in 64-bit arithmetic,
+    // and each message must still fit within the (int) MPI count
+    auto scaledCount =
+      [&]( int count )
+      {
+          const size_t scaled = size_t(count)*size_t(width);
+          if( scaled > size_t(std::numeric_limits<int>::max()) )
+              RuntimeError
+              ("Exchanging ",count," rows of width ",width,
+               " would overflow the MPI count");
+          return int(scaled);
+      };
+    requests.resize( numSends+numRecvs );
+    for( int k=0; k<numRecvs; ++k )
+        IRecv
+        ( &recvBuf[size_t(plan.recvOffs[k])*size_t(width)],
+          scaledCount(plan.recvCounts[k]),
+          plan.recvRanks[k], comm, requests[k] );
+    for( int k=0; k<numSends; ++k )
+        ISend
+        ( &sendBuf[size_t(plan.sendOffs[k])*size_t(width)],
+          scaledCount(plan.sendCounts[k]),
+          plan.sendRanks[k], comm, requests[numRecvs+k] );
+}
+
+template<typename T>
+void NeighborAllToAll
+( const T* sendBuf, T* recvBuf, int width,
+  const NeighborPlan& plan, Comm comm )
+{
+    DEBUG_CSE
+    vector<Request<T>> requests;
+    INeighborAllToAll( sendBuf, recvBuf, width, plan, comm, requests );
+    WaitAll( requests.size(), requests.data() );
+}
+
 #define MPI_PROTO(T) \
   template bool Test( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
   template void Wait( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
@@ -2815,6 +3029,8 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -2962,7 +3178,14 @@ MPI_PROTO(Entry<Complex<BigFloat>>)
           vector<T>& recvBuffer, \
     const vector<int>& recvCounts, \
     const vector<int>& recvDispls, \
-          Comm comm ) EL_NO_RELEASE_EXCEPT;
+          Comm comm ) EL_NO_RELEASE_EXCEPT; \
+  template void NeighborAllToAll \
+  ( const T* sendBuf, T* recvBuf, int width, \
+    const NeighborPlan& plan, Comm comm ); \
+  template void INeighborAllToAll \
+  ( const T* sendBuf, T* recvBuf, int width, \
+    const NeighborPlan& plan, Comm comm, \
+    vector<Request<T>>& requests );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
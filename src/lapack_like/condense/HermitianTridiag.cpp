@@ -47,6 +47,7 @@ void Ger2Sub
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace El {
 
@@ -69,6 +70,10 @@ void HermitianTridiag
   const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE )
+        LogicError
+        ("The two-stage reflectors cannot be packed into householderScalars; "
+         "use herm_tridiag::TwoStage instead");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     DistMatrixWriteProxy<F,F,STAR,STAR>
@@ -161,11 +166,23 @@ void HermitianTridiag
 namespace herm_tridiag {
 
 template<typename F>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
+void ExplicitCondensed
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_CSE
-    Matrix<F> householderScalars;
-    HermitianTridiag( uplo, A, householderScalars );
+    if( ctrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        TwoStageData<F> data;
+        data.storeReflectors = false;
+        TwoStage( uplo, A, data, ctrl );
+    }
+    else
+    {
+        Matrix<F> householderScalars;
+        HermitianTridiag( uplo, A, householderScalars );
+    }
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -179,8 +196,17 @@ void ExplicitCondensed
   const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_CSE
-    DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
-    HermitianTridiag( uplo, A, householderScalars, ctrl );
+    if( ctrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        TwoStageData<F> data;
+        data.storeReflectors = false;
+        TwoStage( uplo, A, data, ctrl );
+    }
+    else
+    {
+        DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
+        HermitianTridiag( uplo, A, householderScalars, ctrl );
+    }
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -200,7 +226,9 @@ void ExplicitCondensed
     AbstractDistMatrix<F>& householderScalars, \
     const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
-  ( UpperOrLower uplo, Matrix<F>& A ); \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
@@ -218,6 +246,30 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    herm_tridiag::TwoStageData<F>& data, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    herm_tridiag::TwoStageData<F>& data, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    const Matrix<F>& A, \
+    const herm_tridiag::TwoStageData<F>& data, \
+          Matrix<F>& B ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const herm_tridiag::TwoStageData<F>& data, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
@@ -0,0 +1,673 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// Two-stage tridiagonalization in the spirit of Bischof, Lang, and Sun's
+// successive band reduction (and of Haidar et al.'s PLASMA/MAGMA variants).
+//
+// The first stage reduces A to a band of width b by applying a panel QR
+// factorization to each b x b block column and then updating the trailing
+// matrix with the two-sided compact-WY transformation
+//
+//   A22 := (I - U inv(SInv) U') A22 (I - U inv(SInv)' U')
+//        = A22 - U W' - W U',
+//
+// where P = A22 U inv(SInv)' and W = P - (1/2) U inv(SInv) U' P, so that
+// essentially all of the work is spent in Hemm and Her2k.
+//
+// The second stage chases the bulges of the band down to tridiagonal form
+// (following Lang's variant, which annihilates a single column of each
+// bulge), which requires storing at most 2b-1 subdiagonals. This stage
+// only requires O(n^2 b) work and is redundantly performed on each process.
+
+template<typename F>
+void ReduceToBand( Matrix<F>& A, Matrix<F>& householderScalars1, Int b )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    householderScalars1.Resize( Max(n-b,0), 1 );
+
+    Matrix<F> householderScalarsPan, U, SInv, X, M;
+    Matrix<Real> signature;
+    for( Int k=0; k+b<n; k+=b )
+    {
+        const Int panHeight = n-(k+b);
+        const Int numRefl = Min(panHeight,b);
+        const Range<Int> ind1( k, k+b ), ind2( k+b, n );
+
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        // Factor the panel and absorb the signature into R so that the
+        // panel's orthogonal factor is exactly the product of reflectors
+        QR( A21, householderScalarsPan, signature );
+        auto R = A21( IR(0,numRefl), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        auto householderScalars1Pan =
+          householderScalars1( IR(k,k+numRefl), ALL );
+        householderScalars1Pan = householderScalarsPan;
+
+        // Convert to an explicit matrix of Householder vectors
+        U = A21( ALL, IR(0,numRefl) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+
+        // Form the small triangular matrix needed for the UT transform
+        Herk( LOWER, ADJOINT, Real(1), U, SInv );
+        for( Int j=0; j<numRefl; ++j )
+            SInv(j,j) = F(1) / householderScalarsPan(j);
+
+        // X := A22 U inv(SInv)'
+        Zeros( X, panHeight, numRefl );
+        Hemm( LEFT, LOWER, F(1), A22, U, F(0), X );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv, X );
+
+        // X := X - (1/2) U inv(SInv) U' X
+        Gemm( ADJOINT, NORMAL, F(1), U, X, M );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv, M );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), U, M, F(1), X );
+
+        // A22 := A22 - U X' - X U'
+        Her2k( LOWER, NORMAL, F(-1), U, X, Real(1), A22 );
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( DistMatrix<F>& A, Matrix<F>& householderScalars1, Int b )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    householderScalars1.Resize( Max(n-b,0), 1 );
+
+    DistMatrix<F,MD,STAR> householderScalarsPan(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    DistMatrix<F,STAR,STAR> householderScalarsPan_STAR_STAR(g),
+                            SInv_STAR_STAR(g), M_STAR_STAR(g);
+    DistMatrix<F> U(g), X(g);
+    DistMatrix<F,VC,STAR> U_VC_STAR(g), X_VC_STAR(g);
+    for( Int k=0; k+b<n; k+=b )
+    {
+        const Int panHeight = n-(k+b);
+        const Int numRefl = Min(panHeight,b);
+        const Range<Int> ind1( k, k+b ), ind2( k+b, n );
+
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        // Factor the panel and absorb the signature into R so that the
+        // panel's orthogonal factor is exactly the product of reflectors
+        QR( A21, householderScalarsPan, signature );
+        auto R = A21( IR(0,numRefl), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        householderScalarsPan_STAR_STAR = householderScalarsPan;
+        auto householderScalars1Pan =
+          householderScalars1( IR(k,k+numRefl), ALL );
+        householderScalars1Pan = householderScalarsPan_STAR_STAR.LockedMatrix();
+
+        // Convert to an explicit matrix of Householder vectors
+        U.AlignWith( A22 );
+        U = A21( ALL, IR(0,numRefl) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        U_VC_STAR = U;
+
+        // Form the small triangular matrix needed for the UT transform
+        Zeros( SInv_STAR_STAR, numRefl, numRefl );
+        Herk
+        ( LOWER, ADJOINT,
+          Real(1), U_VC_STAR.LockedMatrix(),
+          Real(0), SInv_STAR_STAR.Matrix() );
+        El::AllReduce( SInv_STAR_STAR, U_VC_STAR.ColComm() );
+        for( Int j=0; j<numRefl; ++j )
+            SInv_STAR_STAR.SetLocal
+            ( j, j, F(1) / householderScalarsPan_STAR_STAR.GetLocal(j,0) );
+
+        // X := A22 U inv(SInv)'
+        X.AlignWith( A22 );
+        Zeros( X, panHeight, numRefl );
+        Hemm( LEFT, LOWER, F(1), A22, U, F(0), X );
+        X_VC_STAR.AlignWith( U_VC_STAR );
+        X_VC_STAR = X;
+        auto& XLoc = X_VC_STAR.Matrix();
+        Trsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+          F(1), SInv_STAR_STAR.LockedMatrix(), XLoc );
+
+        // X := X - (1/2) U inv(SInv) U' X
+        Zeros( M_STAR_STAR, numRefl, numRefl );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), U_VC_STAR.LockedMatrix(), XLoc,
+          F(0), M_STAR_STAR.Matrix() );
+        El::AllReduce( M_STAR_STAR, U_VC_STAR.ColComm() );
+        Trsm
+        ( LEFT, LOWER, NORMAL, NON_UNIT,
+          F(1), SInv_STAR_STAR.LockedMatrix(), M_STAR_STAR.Matrix() );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1)/F(2), U_VC_STAR.LockedMatrix(), M_STAR_STAR.LockedMatrix(),
+          F(1), XLoc );
+
+        // A22 := A22 - U X' - X U'
+        Her2k( LOWER, NORMAL, F(-1), U_VC_STAR, X_VC_STAR, Real(1), A22 );
+    }
+}
+
+// Annihilate entries (r+1:r+len-1,c) of the Hermitian matrix whose lower
+// triangle is stored in the band format band(i-j,j) = A(i,j). The update
+// only involves the window of indices [c,Min(r+len+b,n)).
+template<typename F>
+F ChaseStep
+( Matrix<F>& band, Int b, Int c, Int r, Int len,
+  Matrix<F>& v, Matrix<F>& W, Matrix<F>& z )
+{
+    DEBUG_CSE
+    const Int n = band.Width();
+    const Int bandHeight = band.Height();
+    const Int winSize = Min(r+len+b,n) - c;
+    const Int s = r-c;
+
+    // Expand the window into a full Hermitian matrix
+    Zeros( W, winSize, winSize );
+    for( Int jj=0; jj<winSize; ++jj )
+    {
+        const Int iiEnd = Min(winSize,jj+bandHeight);
+        for( Int ii=jj; ii<iiEnd; ++ii )
+        {
+            const F value = band(ii-jj,c+jj);
+            W(ii,jj) = value;
+            W(jj,ii) = Conj(value);
+        }
+    }
+
+    // Compute the reflector
+    F beta = W(s,0);
+    auto x = W( IR(s+1,s+len), IR(0) );
+    const F tau = LeftReflector( beta, x );
+    v(0) = F(1);
+    auto vB = v( IR(1,len), ALL );
+    vB = x;
+    Zero( x );
+    W(s,0) = beta;
+
+    // W(S,1:end) := H W(S,1:end) = W(S,1:end) - tau v (W(S,1:end)' v)'
+    auto WLeft = W( IR(s,s+len), IR(1,winSize) );
+    Zeros( z, winSize-1, 1 );
+    Gemv( ADJOINT, F(1), WLeft, v, F(0), z );
+    Ger( -tau, v, z, WLeft );
+
+    // W(1:end,S) := W(1:end,S) H' = W(1:end,S) - conj(tau) (W(1:end,S) v) v'
+    auto WRight = W( IR(1,winSize), IR(s,s+len) );
+    Gemv( NORMAL, F(1), WRight, v, F(0), z );
+    Ger( -Conj(tau), z, v, WRight );
+
+    // Store the lower triangle of the window back into the band
+    for( Int jj=0; jj<winSize; ++jj )
+    {
+        band(0,c+jj) = RealPart(W(jj,jj));
+        const Int iiEnd = Min(winSize,jj+bandHeight);
+        for( Int ii=jj+1; ii<iiEnd; ++ii )
+            band(ii-jj,c+jj) = W(ii,jj);
+    }
+    return tau;
+}
+
+// Set sweepOffs[j] to the index of the first bulge-chasing reflector of the
+// j'th sweep, with a final entry equal to the total number of reflectors.
+// Each sweep begins by annihilating column j below its first subdiagonal
+// (which, even for a single entry, is needed to ensure that it is real) and
+// then chases the resulting bulge down the band in steps of b.
+inline void BulgeSweepOffsets( Int n, Int b, vector<Int>& sweepOffs )
+{
+    const Int numSweeps = Max(n-1,0);
+    sweepOffs.resize( numSweeps+1 );
+    Int numRefl = 0;
+    for( Int j=0; j<numSweeps; ++j )
+    {
+        sweepOffs[j] = numRefl;
+        for( Int r=j+1; r<n; r+=b )
+        {
+            if( r > j+1 && Min(b,n-r) < 2 )
+                break;
+            ++numRefl;
+        }
+    }
+    sweepOffs[numSweeps] = numRefl;
+}
+
+template<typename F>
+void ChaseBulges( Matrix<F>& band, TwoStageData<F>& data )
+{
+    DEBUG_CSE
+    const Int n = band.Width();
+    const Int b = data.bandwidth;
+
+    vector<Int> sweepOffs;
+    BulgeSweepOffsets( n, b, sweepOffs );
+    const Int numRefl = sweepOffs.back();
+    if( data.storeReflectors )
+    {
+        Zeros( data.V2, b, numRefl );
+        data.householderScalars2.Resize( numRefl, 1 );
+        data.offsets2.resize( numRefl );
+    }
+    else
+    {
+        data.V2.Empty();
+        data.householderScalars2.Empty();
+        data.offsets2.clear();
+    }
+
+    Matrix<F> vWork, W, z;
+    Zeros( vWork, b, 1 );
+    Int refl = 0;
+    for( Int j=0; j<n-1; ++j )
+    {
+        Int c = j;
+        for( Int r=j+1; r<n; r+=b )
+        {
+            const Int len = Min(b,n-r);
+            if( r > j+1 && len < 2 )
+                break;
+            if( data.storeReflectors )
+            {
+                auto v = data.V2( IR(0,len), IR(refl) );
+                data.householderScalars2(refl) =
+                  ChaseStep( band, b, c, r, len, v, W, z );
+                data.offsets2[refl] = r;
+            }
+            else
+            {
+                auto v = vWork( IR(0,len), ALL );
+                ChaseStep( band, b, c, r, len, v, W, z );
+            }
+            ++refl;
+            c = r;
+        }
+    }
+}
+
+// Apply the product of the bulge-chasing reflectors,
+//
+//   Q2 = H_0' H_1' ... H_{k-1}',
+//
+// (or its adjoint) to the local columns (or rows) of B.
+//
+// The reflector of step s of sweep j only overlaps those of steps s and s-1
+// of the subsequent sweeps, so, for each group of b consecutive sweeps, the
+// product can be reordered so that the reflectors of step s of the group are
+// adjacent (with the steps in decreasing order). Each such set of reflectors
+// is applied as a single (UT) compact-WY transform,
+//
+//   H_j' H_{j+1}' ... = I - V inv(SInv) V',
+//
+// where SInv is the upper triangle of V' V with its diagonal set to the
+// inverses of the conjugated Householder scalars.
+template<typename F>
+void ApplyBulgeReflectors
+( LeftOrRight side,
+  Orientation orientation,
+  const TwoStageData<F>& data,
+        Matrix<F>& B )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( data.oneStage )
+        return;
+    const bool normal = ( orientation == NORMAL );
+    const bool backward = ( (side==LEFT) == normal );
+    const Int n = ( side==LEFT ? B.Height() : B.Width() );
+    const Int b = data.bandwidth;
+
+    vector<Int> sweepOffs;
+    BulgeSweepOffsets( n, b, sweepOffs );
+    if( data.householderScalars2.Height() != sweepOffs.back() )
+        LogicError("The bulge-chasing reflectors were not stored");
+
+    // Form the sequence of (first sweep, step, number of sweeps) blocks
+    vector<Int> blockSweeps, blockSteps, blockSizes;
+    const Int numSweeps = sweepOffs.size()-1;
+    for( Int J=0; J<numSweeps; J+=b )
+    {
+        const Int JEnd = Min(J+b,numSweeps);
+        const Int numSteps = sweepOffs[J+1]-sweepOffs[J];
+        for( Int step=numSteps-1; step>=0; --step )
+        {
+            // The number of steps of each sweep is non-increasing
+            Int size = 0;
+            while( J+size < JEnd &&
+                   sweepOffs[J+size+1]-sweepOffs[J+size] > step )
+                ++size;
+            blockSweeps.push_back( J );
+            blockSteps.push_back( step );
+            blockSizes.push_back( size );
+        }
+    }
+
+    Matrix<F> V, SInv, M;
+    const Int numBlocks = blockSizes.size();
+    for( Int t=0; t<numBlocks; ++t )
+    {
+        const Int block = ( backward ? numBlocks-1-t : t );
+        const Int J = blockSweeps[block];
+        const Int step = blockSteps[block];
+        const Int size = blockSizes[block];
+        const Int off = J+1+step*b;
+        const Int height = Min(b+size-1,n-off);
+
+        // Expand the staircase of reflectors and form the UT transform
+        Zeros( V, height, size );
+        for( Int i=0; i<size; ++i )
+        {
+            const Int refl = sweepOffs[J+i] + step;
+            const Int len = Min(b,n-(off+i));
+            auto v = V( IR(i,i+len), IR(i) );
+            v = data.V2( IR(0,len), IR(refl) );
+        }
+        Herk( UPPER, ADJOINT, Real(1), V, SInv );
+        for( Int i=0; i<size; ++i )
+        {
+            const Int refl = sweepOffs[J+i] + step;
+            SInv(i,i) = F(1) / Conj(data.householderScalars2(refl));
+        }
+
+        const Orientation SOrient = ( normal ? NORMAL : ADJOINT );
+        if( side == LEFT )
+        {
+            // BS := (I - V inv(SInv) V') BS or (I - V inv(SInv)' V') BS
+            auto BS = B( IR(off,off+height), ALL );
+            Gemm( ADJOINT, NORMAL, F(1), V, BS, M );
+            Trsm( LEFT, UPPER, SOrient, NON_UNIT, F(1), SInv, M );
+            Gemm( NORMAL, NORMAL, F(-1), V, M, F(1), BS );
+        }
+        else
+        {
+            // BS := BS (I - V inv(SInv) V') or BS (I - V inv(SInv)' V')
+            auto BS = B( ALL, IR(off,off+height) );
+            Gemm( NORMAL, NORMAL, F(1), BS, V, M );
+            Trsm( RIGHT, UPPER, SOrient, NON_UNIT, F(1), SInv, M );
+            Gemm( NORMAL, ADJOINT, F(-1), M, V, F(1), BS );
+        }
+    }
+}
+
+// Each process applies the (redundantly stored) bulge-chasing reflectors
+// to its own subset of the columns (or rows) of B
+template<typename F>
+void ApplyBulgeReflectors
+( LeftOrRight side,
+  Orientation orientation,
+  const TwoStageData<F>& data,
+        AbstractDistMatrix<F>& B )
+{
+    DEBUG_CSE
+    if( data.oneStage )
+        return;
+    if( side == LEFT )
+    {
+        DistMatrix<F,STAR,VR> B_STAR_VR( B );
+        ApplyBulgeReflectors( side, orientation, data, B_STAR_VR.Matrix() );
+        Copy( B_STAR_VR, B );
+    }
+    else
+    {
+        DistMatrix<F,VC,STAR> B_VC_STAR( B );
+        ApplyBulgeReflectors( side, orientation, data, B_VC_STAR.Matrix() );
+        Copy( B_VC_STAR, B );
+    }
+}
+
+template<typename F>
+Int TwoStageBandwidth( Int n, const HermitianTridiagCtrl<F>& ctrl )
+{
+    const Int b = ( ctrl.bandwidth > 0 ? ctrl.bandwidth : Blocksize() );
+    return Max( Min(b,n-1), 1 );
+}
+
+template<typename F>
+void TwoStageLower
+( Matrix<F>& A, TwoStageData<F>& data, const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = TwoStageBandwidth( n, ctrl );
+    data.bandwidth = b;
+    data.oneStage = false;
+
+    ReduceToBand( A, data.householderScalars1, b );
+
+    Matrix<F> band;
+    Zeros( band, 2*b, n );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iEnd = Min(j+b+1,n);
+        for( Int i=j; i<iEnd; ++i )
+            band(i-j,j) = A(i,j);
+    }
+
+    ChaseBulges( band, data );
+
+    // Overwrite the band with the tridiagonal matrix, leaving the
+    // reflectors from the first stage untouched
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iEnd = Min(j+b+1,n);
+        for( Int i=j; i<iEnd; ++i )
+            A(i,j) = ( i-j <= 1 ? band(i-j,j) : F(0) );
+    }
+}
+
+template<typename F>
+void TwoStageLower
+( DistMatrix<F>& A,
+  TwoStageData<F>& data,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = TwoStageBandwidth( n, ctrl );
+    if( data.storeReflectors )
+    {
+        vector<Int> sweepOffs;
+        BulgeSweepOffsets( n, b, sweepOffs );
+        const double numEntries = double(b)*sweepOffs.back();
+        if( numEntries > double(ctrl.maxRedundantEntries) )
+        {
+            // Every process would need to store all of the bulge-chasing
+            // reflectors, so fall back to the one-stage reduction, whose
+            // reflectors are distributed (and which is equivalent to a
+            // two-stage reduction with a bandwidth of one and no bulges)
+            HermitianTridiagCtrl<F> oneStageCtrl( ctrl );
+            oneStageCtrl.approach = HERMITIAN_TRIDIAG_SQUARE;
+            DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
+            HermitianTridiag( LOWER, A, householderScalars, oneStageCtrl );
+            data.bandwidth = 1;
+            data.oneStage = true;
+            data.householderScalars1 = householderScalars.Matrix();
+            data.V2.Empty();
+            data.householderScalars2.Empty();
+            data.offsets2.clear();
+            return;
+        }
+    }
+    data.bandwidth = b;
+    data.oneStage = false;
+
+    ReduceToBand( A, data.householderScalars1, b );
+
+    // Gather the band onto every process
+    auto& ALoc = A.Matrix();
+    const Int localWidth = A.LocalWidth();
+    Matrix<F> band;
+    Zeros( band, 2*b, n );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+b+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            band(A.GlobalRow(iLoc)-j,j) = ALoc(iLoc,jLoc);
+    }
+    mpi::AllReduce( band.Buffer(), 2*b*n, A.DistComm() );
+
+    ChaseBulges( band, data );
+
+    // Overwrite the band with the tridiagonal matrix, leaving the
+    // reflectors from the first stage untouched
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+b+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            ALoc(iLoc,jLoc) = ( i-j <= 1 ? band(i-j,j) : F(0) );
+        }
+    }
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  TwoStageData<F>& data,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    if( uplo == LOWER )
+    {
+        TwoStageLower( A, data, ctrl );
+    }
+    else
+    {
+        // Reduce the adjoint so that the reflectors are stored by row
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        TwoStageLower( AAdj, data, ctrl );
+        Adjoint( AAdj, A );
+    }
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  TwoStageData<F>& data,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    if( uplo == LOWER )
+    {
+        TwoStageLower( A, data, ctrl );
+    }
+    else
+    {
+        // Reduce the adjoint so that the reflectors are stored by row
+        DistMatrix<F> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+        TwoStageLower( AAdj, data, ctrl );
+        Adjoint( AAdj, A );
+    }
+}
+
+// Since A = Q1 (Q2 T Q2') Q1', where Q1 is the product of the reflectors from
+// the reduction to banded form and Q2 that of the bulge-chasing reflectors,
+// Q = Q1 Q2
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<F>& A,
+  const TwoStageData<F>& data,
+        Matrix<F>& B )
+{
+    DEBUG_CSE
+    if( uplo == UPPER )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        ApplyQ( side, LOWER, orientation, AAdj, data, B );
+        return;
+    }
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    const bool bulgesFirst = ( normal == onLeft );
+
+    if( bulgesFirst )
+        ApplyBulgeReflectors( side, orientation, data, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -data.bandwidth,
+      A, data.householderScalars1, B );
+    if( !bulgesFirst )
+        ApplyBulgeReflectors( side, orientation, data, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const TwoStageData<F>& data,
+        AbstractDistMatrix<F>& B )
+{
+    DEBUG_CSE
+    const Grid& g = A.Grid();
+    if( uplo == UPPER )
+    {
+        DistMatrix<F> AAdj(g);
+        Adjoint( A, AAdj );
+        ApplyQ( side, LOWER, orientation, AAdj, data, B );
+        return;
+    }
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    const bool bulgesFirst = ( normal == onLeft );
+
+    DistMatrix<F,STAR,STAR> householderScalars1(g);
+    householderScalars1.Resize( data.householderScalars1.Height(), 1 );
+    householderScalars1.Matrix() = data.householderScalars1;
+
+    if( bulgesFirst )
+        ApplyBulgeReflectors( side, orientation, data, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -data.bandwidth,
+      A, householderScalars1, B );
+    if( !bulgesFirst )
+        ApplyBulgeReflectors( side, orientation, data, B );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
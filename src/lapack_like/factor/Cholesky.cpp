@@ -120,10 +120,36 @@ void Cholesky
         cholesky::PivotedUpperVariant3Blocked( A, p );
 }
 
+// Each process redundantly factors its own copy of A, so the blocksize is
+// chosen by a single process: otherwise, different tuned (or tuning)
+// blocksizes would lead to different factors on different processes
 template<typename F>
 void Cholesky
 ( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A )
-{ Cholesky( uplo, A.Matrix() ); }
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    if( !A.Participating() )
+        return;
+    if( A.RedundantSize() == 1 )
+    {
+        Cholesky( uplo, A.Matrix() );
+        return;
+    }
+    Int bsize = 0;
+    if( A.RedundantRank() == 0 )
+        bsize = ( uplo == LOWER ?
+                  cholesky::LowerVariant3Blocksize( A.LockedMatrix() ) :
+                  cholesky::UpperVariant3Blocksize( A.LockedMatrix() ) );
+    mpi::Broadcast( bsize, 0, A.RedundantComm() );
+    if( uplo == LOWER )
+        cholesky::LowerVariant3Blocked( A.Matrix(), bsize );
+    else
+        cholesky::UpperVariant3Blocked( A.Matrix(), bsize );
+}
 
 template<typename F> 
 void ReverseCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A )
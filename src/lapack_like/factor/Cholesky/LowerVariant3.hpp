@@ -41,7 +41,7 @@ void LowerVariant3Unblocked( Matrix<F>& A )
 }
 
 template<typename F>
-void LowerVariant3Blocked( Matrix<F>& A )
+void LowerVariant3Blocked( Matrix<F>& A, Int bsize )
 {
     DEBUG_CSE
     DEBUG_ONLY(
@@ -49,7 +49,6 @@ void LowerVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -67,6 +66,34 @@ void LowerVariant3Blocked( Matrix<F>& A )
     }
 }
 
+// The explicit, previously tuned, or (if tuning is enabled) newly tuned
+// blocksize for factoring A
+template<typename F>
+Int LowerVariant3Blocksize( const Matrix<F>& A )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    // Only construct the trial when it might be run
+    if( BlocksizeTuning() )
+    {
+        auto trial = [&]( Int candidate )
+          {
+              Matrix<F> ACopy( A );
+              LowerVariant3Blocked( ACopy, candidate );
+          };
+        return Blocksize<F>( "CholeskyLower", n, n, trial );
+    }
+    else
+        return Blocksize<F>( "CholeskyLower", n, n );
+}
+
+template<typename F>
+void LowerVariant3Blocked( Matrix<F>& A )
+{
+    DEBUG_CSE
+    LowerVariant3Blocked( A, LowerVariant3Blocksize( A ) );
+}
+
 template<typename F>
 void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
 {
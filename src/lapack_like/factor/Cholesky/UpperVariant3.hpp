@@ -46,7 +46,7 @@ void UpperVariant3Unblocked( Matrix<F>& A )
 }
 
 template<typename F>
-void UpperVariant3Blocked( Matrix<F>& A )
+void UpperVariant3Blocked( Matrix<F>& A, Int bsize )
 {
     DEBUG_CSE
     DEBUG_ONLY(
@@ -54,7 +54,6 @@ void UpperVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -72,6 +71,34 @@ void UpperVariant3Blocked( Matrix<F>& A )
     }
 }
 
+// The explicit, previously tuned, or (if tuning is enabled) newly tuned
+// blocksize for factoring A
+template<typename F>
+Int UpperVariant3Blocksize( const Matrix<F>& A )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    // Only construct the trial when it might be run
+    if( BlocksizeTuning() )
+    {
+        auto trial = [&]( Int candidate )
+          {
+              Matrix<F> ACopy( A );
+              UpperVariant3Blocked( ACopy, candidate );
+          };
+        return Blocksize<F>( "CholeskyUpper", n, n, trial );
+    }
+    else
+        return Blocksize<F>( "CholeskyUpper", n, n );
+}
+
+template<typename F>
+void UpperVariant3Blocked( Matrix<F>& A )
+{
+    DEBUG_CSE
+    UpperVariant3Blocked( A, UpperVariant3Blocksize( A ) );
+}
+
 template<typename F>
 void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
 {
@@ -86,7 +86,8 @@ template<typename F>
 void LDL
 ( const ldl::NodeInfo& info,
         ldl::Front<F>& front,
-  LDLFrontType newType )
+  LDLFrontType newType,
+  const ldl::BLRCtrl<Base<F>>& blrCtrl )
 {
     DEBUG_CSE
     if( !Unfactored(front.type) )
@@ -96,7 +97,7 @@ void LDL
     ChangeFrontType( front, SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( info, front, InitialFactorType(newType) );
+    ldl::Process( info, front, InitialFactorType(newType), blrCtrl );
 
     // Convert the fronts from the initial factorization to the requested form
     ChangeFrontType( front, newType );
@@ -106,7 +107,8 @@ template<typename F>
 void LDL
 ( const ldl::DistNodeInfo& info,
         ldl::DistFront<F>& front,
-  LDLFrontType newType )
+  LDLFrontType newType,
+  const ldl::BLRCtrl<Base<F>>& blrCtrl )
 {
     DEBUG_CSE
     if( !Unfactored(front.type) )
@@ -116,7 +118,7 @@ void LDL
     ChangeFrontType( front, SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( info, front, InitialFactorType(newType) );
+    ldl::Process( info, front, InitialFactorType(newType), blrCtrl );
 
     // Convert the fronts from the initial factorization to the requested form
     ChangeFrontType( front, newType );
@@ -190,11 +192,13 @@ void LDL
   template void LDL \
   ( const ldl::NodeInfo& info, \
           ldl::Front<F>& front, \
-    LDLFrontType newType ); \
+    LDLFrontType newType, \
+    const ldl::BLRCtrl<Base<F>>& blrCtrl ); \
   template void LDL \
   ( const ldl::DistNodeInfo& info, \
           ldl::DistFront<F>& front, \
-    LDLFrontType newType );
+    LDLFrontType newType, \
+    const ldl::BLRCtrl<Base<F>>& blrCtrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+template<typename F>
+Int BLRMatrix<F>::NumEntries() const
+{
+    Int numEntries = 0;
+    const Int numTiles = U.size();
+    for( Int t=0; t<numTiles; ++t )
+        numEntries += U[t].Height()*U[t].Width() + V[t].Height()*V[t].Width();
+    return numEntries;
+}
+
+template<typename F>
+void BLRMatrix<F>::Empty()
+{
+    height = width = tileSize = 0;
+    SwapClear( U );
+    SwapClear( V );
+}
+
+template<typename F>
+void Compress
+( const Matrix<F>& A, BLRMatrix<F>& B, const BLRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.tileSize < 1 )
+        LogicError("The BLR tile size must be positive");
+    B.height = A.Height();
+    B.width = A.Width();
+    B.tileSize = ctrl.tileSize;
+    const Int numTileRows = B.NumTileRows();
+    const Int numTileCols = B.NumTileCols();
+    B.U.clear();
+    B.V.clear();
+    B.U.resize( numTileRows*numTileCols );
+    B.V.resize( numTileRows*numTileCols );
+
+    QRCtrl<Base<F>> qrCtrl;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = ctrl.relTol;
+    qrCtrl.boundRank = true;
+
+    Permutation Omega;
+    Matrix<F> Z, APerm;
+    for( Int J=0; J<numTileCols; ++J )
+    {
+        const Range<Int> indJ( J*B.tileSize, Min((J+1)*B.tileSize,B.width) );
+        for( Int I=0; I<numTileRows; ++I )
+        {
+            const Range<Int>
+              indI( I*B.tileSize, Min((I+1)*B.tileSize,B.height) );
+            auto ATile = A( indI, indJ );
+            auto& U = B.U[I+J*numTileRows];
+            auto& V = B.V[I+J*numTileRows];
+            const Int mTile = ATile.Height();
+            const Int nTile = ATile.Width();
+
+            // The low-rank form is only kept if it is smaller than the tile,
+            // so there is no need to run past the break-even rank
+            qrCtrl.maxRank = (mTile*nTile) / (mTile+nTile);
+            Int rank = qrCtrl.maxRank;
+            if( qrCtrl.maxRank > 0 )
+            {
+                ID( ATile, Omega, Z, qrCtrl );
+                rank = Z.Height();
+            }
+            if( rank == qrCtrl.maxRank )
+            {
+                U = ATile;
+                V.Empty();
+                continue;
+            }
+
+            // A Omega^T ~= A Omega^T(:,0:rank) [I, Z], so that
+            // A ~= (A Omega^T)(:,0:rank) ([I, Z] Omega)
+            APerm = ATile;
+            Omega.PermuteCols( APerm );
+            U = APerm( ALL, IR(0,rank) );
+            Zeros( V, rank, nTile );
+            auto VL = V( ALL, IR(0,rank) );
+            auto VR = V( ALL, IR(rank,nTile) );
+            FillDiagonal( VL, F(1) );
+            VR = Z;
+            Omega.InversePermuteCols( V );
+        }
+    }
+}
+
+template<typename F>
+void Decompress( const BLRMatrix<F>& B, Matrix<F>& A )
+{
+    DEBUG_CSE
+    Zeros( A, B.height, B.width );
+    const Int numTileRows = B.NumTileRows();
+    const Int numTileCols = B.NumTileCols();
+    for( Int J=0; J<numTileCols; ++J )
+    {
+        const Range<Int> indJ( J*B.tileSize, Min((J+1)*B.tileSize,B.width) );
+        for( Int I=0; I<numTileRows; ++I )
+        {
+            const Range<Int>
+              indI( I*B.tileSize, Min((I+1)*B.tileSize,B.height) );
+            auto ATile = A( indI, indJ );
+            const auto& U = B.U[I+J*numTileRows];
+            const auto& V = B.V[I+J*numTileRows];
+            if( !B.LowRank(I,J) )
+                ATile = U;
+            else if( V.Height() > 0 )
+                Gemm( NORMAL, NORMAL, F(1), U, V, F(0), ATile );
+        }
+    }
+}
+
+template<typename F>
+void Multiply
+( Orientation orientation,
+  F alpha, const BLRMatrix<F>& B, const Matrix<F>& X,
+  F beta,                               Matrix<F>& Y )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      const Int BHeight = ( orientation==NORMAL ? B.height : B.width );
+      const Int BWidth = ( orientation==NORMAL ? B.width : B.height );
+      if( X.Height() != BWidth || Y.Height() != BHeight ||
+          X.Width() != Y.Width() )
+          LogicError("Nonconformal BLR multiply");
+    )
+    Y *= beta;
+    const Int numTileRows = B.NumTileRows();
+    const Int numTileCols = B.NumTileCols();
+    Matrix<F> Z;
+    for( Int J=0; J<numTileCols; ++J )
+    {
+        const Range<Int> indJ( J*B.tileSize, Min((J+1)*B.tileSize,B.width) );
+        for( Int I=0; I<numTileRows; ++I )
+        {
+            const Range<Int>
+              indI( I*B.tileSize, Min((I+1)*B.tileSize,B.height) );
+            const auto& U = B.U[I+J*numTileRows];
+            const auto& V = B.V[I+J*numTileRows];
+            const bool normal = ( orientation == NORMAL );
+            auto XTile = X( normal ? indJ : indI, ALL );
+            auto YTile = Y( normal ? indI : indJ, ALL );
+            if( !B.LowRank(I,J) )
+            {
+                Gemm( orientation, NORMAL, alpha, U, XTile, F(1), YTile );
+            }
+            else if( V.Height() > 0 )
+            {
+                // op(U V) X = op(V) (op(U) X)
+                if( normal )
+                {
+                    Gemm( NORMAL, NORMAL, F(1), V, XTile, Z );
+                    Gemm( NORMAL, NORMAL, alpha, U, Z, F(1), YTile );
+                }
+                else
+                {
+                    Gemm( orientation, NORMAL, F(1), U, XTile, Z );
+                    Gemm( orientation, NORMAL, alpha, V, Z, F(1), YTile );
+                }
+            }
+        }
+    }
+}
+
+#define PROTO(F) \
+  template struct BLRMatrix<F>; \
+  template void Compress \
+  ( const Matrix<F>& A, BLRMatrix<F>& B, const BLRCtrl<Base<F>>& ctrl ); \
+  template void Decompress( const BLRMatrix<F>& B, Matrix<F>& A ); \
+  template void Multiply \
+  ( Orientation orientation, \
+    F alpha, const BLRMatrix<F>& B, const Matrix<F>& X, \
+    F beta,                               Matrix<F>& Y );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
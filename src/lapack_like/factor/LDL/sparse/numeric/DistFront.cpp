@@ -65,22 +65,36 @@ void UnpackEntriesLocal
   const vector<F>& rEntries, 
   const vector<Int>& rTargets,
         vector<int>& offs, 
-        vector<int>& entryOffs )
+        vector<int>& entryOffs,
+  bool reuse )
 {
     DEBUG_CSE
 
-    // Delete any existing children
-    for( auto* childFront : front.children )
-        delete childFront;
-
+    // Unless the fronts from a previous pull of the same structure are to
+    // be reused, delete any existing children
     const Int numChildren = sep.children.size();
-    front.children.resize( numChildren );
+    if( reuse )
+    {
+        DEBUG_ONLY(
+          if( Int(front.children.size()) != numChildren )
+              LogicError("Front tree did not match the separator tree");
+        )
+    }
+    else
+    {
+        for( auto* childFront : front.children )
+            delete childFront;
+        front.children.resize( numChildren );
+        for( Int c=0; c<numChildren; ++c )
+            front.children[c] = new Front<F>(&front);
+    }
     for( Int c=0; c<numChildren; ++c )
     {
-        front.children[c] = new Front<F>(&front);
+        front.children[c]->type = front.type;
+        front.children[c]->isHermitian = front.isHermitian;
         UnpackEntriesLocal
         ( *sep.children[c], *node.children[c], *front.children[c], 
-          A, rRowLengths, rEntries, rTargets, offs, entryOffs );
+          A, rRowLengths, rEntries, rTargets, offs, entryOffs, reuse );
     }
     // Mark this node as a sparse leaf if it does not have any children
     // and is not a duplicate of a dense distributed node
@@ -158,6 +172,7 @@ void UnpackEntriesLocal
     }
     else
     {
+        front.LBLR.Empty();
         Zeros( front.LDense, size+lowerSize, size );
         for( Int t=0; t<size; ++t )
         {
@@ -203,28 +218,44 @@ void UnpackEntries
   const vector<F>& rEntries, 
   const vector<Int>& rTargets,
         vector<int>& offs, 
-        vector<int>& entryOffs )
+        vector<int>& entryOffs,
+  bool reuse )
 {
     DEBUG_CSE
     const Grid& grid = *node.grid;
 
+    // Reused fronts keep the metadata for exchanging the child updates
+    // during the factorization
+    if( !reuse )
+        front.commMeta.Empty();
+
     if( sep.child == nullptr )
     {
-        delete front.duplicate;
-        front.duplicate = new Front<F>(&front);
+        if( !reuse )
+        {
+            delete front.duplicate;
+            front.duplicate = new Front<F>(&front);
+        }
+        front.duplicate->type = front.type;
+        front.duplicate->isHermitian = front.isHermitian;
         UnpackEntriesLocal
         ( *sep.duplicate, *node.duplicate, *front.duplicate, 
-          A, rRowLengths, rEntries, rTargets, offs, entryOffs );
+          A, rRowLengths, rEntries, rTargets, offs, entryOffs, reuse );
 
         front.L2D.Attach( grid, front.duplicate->LDense );
 
         return;
     }
-    delete front.child;
-    front.child = new DistFront<F>(&front);
+    if( !reuse )
+    {
+        delete front.child;
+        front.child = new DistFront<F>(&front);
+    }
+    front.child->type = front.type;
+    front.child->isHermitian = front.isHermitian;
     UnpackEntries
     ( *sep.child, *node.child, *front.child, 
-      A, rRowLengths, rEntries, rTargets, offs, entryOffs );
+      A, rRowLengths, rEntries, rTargets, offs, entryOffs, reuse );
 
     const Int size = node.size;
     const Int off = node.off;
@@ -295,33 +326,99 @@ void DistFront<F>::Pull
         vector<Int>& mappedTargets,
         vector<Int>& colOffs,
   bool conjugate )
+{
+    DEBUG_CSE
+    DistFrontPullMeta meta;
+    meta.mappedSources.swap( mappedSources );
+    meta.mappedTargets.swap( mappedTargets );
+    meta.colOffs.swap( colOffs );
+    Pull( A, reordering, rootSep, rootInfo, meta, conjugate );
+    mappedSources.swap( meta.mappedSources );
+    mappedTargets.swap( meta.mappedTargets );
+    colOffs.swap( meta.colOffs );
+}
+
+template<typename F>
+void DistFront<F>::Pull
+( const DistSparseMatrix<F>& A, 
+  const DistMap& reordering,
+  const DistSeparator& rootSep, 
+  const DistNodeInfo& rootInfo,
+        DistFrontPullMeta& meta,
+  bool conjugate )
 {
     DEBUG_CSE
     DEBUG_ONLY(
       if( A.LocalHeight() != reordering.NumLocalSources() )
           LogicError("Local mapping was not the right size");
     )
-    const bool time = false;
-   
     mpi::Comm comm = A.Comm();
-    const int commSize = mpi::Size( comm );
-    const int commRank = mpi::Rank( comm ); 
     Timer timer;
 
+    // The fronts are only reused if they were formed by a previous pull
+    // with the same metadata
+    const bool reuse =
+      meta.initialized && (child != nullptr || duplicate != nullptr);
+    timer.Start();
+    if( !meta.initialized )
+        meta.Initialize( A, reordering, rootSep, rootInfo );
+    meta.metaTime = timer.Stop();
+
+    // Pack, exchange, and unpack the nonzeros
+    timer.Start();
+    const Int numSendEntries = meta.sendInds.size();
+    const Int numRecvEntries = meta.targets.size();
+    DEBUG_ONLY(
+      for( Int k=0; k<numSendEntries; ++k )
+          if( meta.sendInds[k] >= A.NumLocalEntries() )
+              LogicError("Sparsity pattern changed since the pull metadata");
+    )
+    const F* valueBuf = A.LockedValueBuffer();
+    vector<F> sEntries( numSendEntries ), rEntries( numRecvEntries );
+    for( Int k=0; k<numSendEntries; ++k )
+    {
+        const F value = valueBuf[meta.sendInds[k]];
+        sEntries[k] = ( conjugate ? Conj(value) : value );
+    }
+    mpi::AllToAll
+    ( sEntries.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      rEntries.data(), meta.recvSizes.data(), meta.recvOffs.data(), comm );
+    SwapClear( sEntries );
+
+    // TODO: Modify constructor of [Dist]Front to default to SYMM_2D?
+    type = SYMM_2D;
+    isHermitian = conjugate;
+    auto offs = meta.rowOffs;
+    auto entryOffs = meta.recvOffs;
+    UnpackEntries
+    ( rootSep, rootInfo, *this, 
+      A, meta.rowLengths, rEntries, meta.targets, offs, entryOffs, reuse );
+    meta.valueTime = timer.Stop();
+}
+
+template<typename F>
+void DistFrontPullMeta::Initialize
+( const DistSparseMatrix<F>& A,
+  const DistMap& reordering,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo )
+{
+    DEBUG_CSE
+    mpi::Comm comm = A.Comm();
+    const int commSize = mpi::Size( comm );
+
     A.MappedSources( reordering, mappedSources );
     A.MappedTargets( reordering, mappedTargets, colOffs );
 
     // Set up the indices for the rows we need from each process
-    if( time && commRank == 0 )
-        timer.Start();
-    vector<int> rRowSizes( commSize, 0 );
+    rowSizes.assign( commSize, 0 );
     function<void(const Separator&)> rRowLocalAccumulate = 
       [&]( const Separator& sep )
       {
           for( const Separator* child : sep.children )
              rRowLocalAccumulate( *child );
           for( const Int& i : sep.inds )
-              ++rRowSizes[ A.RowOwner(i) ];
+              ++rowSizes[ A.RowOwner(i) ];
       };
     function<void(const DistSeparator&,const DistNodeInfo&)> 
       rRowAccumulate =
@@ -339,18 +436,13 @@ void DistFront<F>::Pull
           const Int rowStride = grid.Width();
           const Int numInds = sep.inds.size();
           for( Int t=rowShift; t<numInds; t+=rowStride )
-              ++rRowSizes[ A.RowOwner(sep.inds[t]) ];
+              ++rowSizes[ A.RowOwner(sep.inds[t]) ];
       };
     rRowAccumulate( rootSep, rootInfo );
-    vector<int> rRowOffs;
-    const Int numRecvRows = Scan( rRowSizes, rRowOffs );
-    if( time && commRank == 0 )
-        Output("Row index setup: ",timer.Stop()," secs");
+    const Int numRecvRows = Scan( rowSizes, rowOffs );
 
-    if( time && commRank == 0 )
-        timer.Start();
     vector<Int> rRows( numRecvRows );
-    auto offs = rRowOffs;
+    auto offs = rowOffs;
     function<void(const Separator&)> rRowsLocalPack = 
       [&]( const Separator& sep )
       {
@@ -380,29 +472,25 @@ void DistFront<F>::Pull
           }
       };
     rRowsPack( rootSep, rootInfo );
-    if( time && commRank == 0 )
-        Output("Row index pack: ",timer.Stop()," secs");
+    SwapClear( offs );
 
     // Retreive the list of rows that we must send to each process
-    if( time && commRank == 0 )
-        timer.Start();
     vector<int> sRowSizes( commSize );
-    mpi::AllToAll( rRowSizes.data(), 1, sRowSizes.data(), 1, comm );
+    mpi::AllToAll( rowSizes.data(), 1, sRowSizes.data(), 1, comm );
     vector<int> sRowOffs;
     const Int numSendRows = Scan( sRowSizes, sRowOffs );
     vector<Int> sRows( numSendRows );
     mpi::AllToAll
-    ( rRows.data(), rRowSizes.data(), rRowOffs.data(),
+    ( rRows.data(), rowSizes.data(), rowOffs.data(),
       sRows.data(), sRowSizes.data(), sRowOffs.data(), comm );
-    if( time && commRank == 0 )
-        Output("AllToAll: ",timer.Stop()," secs");
+    SwapClear( rRows );
 
-    // Pack the number of nonzeros per row (and the nonzeros themselves)
-    if( time && commRank == 0 )
-        timer.Start();
+    // Find the nonzeros of the lower triangle of each row that we must send
+    // (and their reordered targets)
     const Int firstLocalRow = A.FirstLocalRow();
-    vector<Int> sRowLengths( numSendRows );
-    vector<int> sEntriesSizes(commSize,0);
+    vector<Int> sRowLengths( numSendRows ), sTargets;
+    sendSizes.assign( commSize, 0 );
+    sendInds.clear();
     for( Int q=0; q<commSize; ++q )
     {
         const Int size = sRowSizes[q];
@@ -420,87 +508,53 @@ void DistFront<F>::Pull
                 const Int iReord = mappedTargets[colOffs[rowOff+e]];
                 if( iReord >= jReord )
                 {
-                    ++sEntriesSizes[q];
+                    sendInds.push_back( rowOff+e );
+                    sTargets.push_back( iReord );
+                    ++sendSizes[q];
                     ++sRowLengths[s+off];
                 }
             }
         }
     }
-    vector<int> sEntriesOffs;
-    const int numSendEntries = Scan( sEntriesSizes, sEntriesOffs );
-    vector<F> sEntries( numSendEntries );
-    vector<Int> sTargets( numSendEntries );
-    for( Int q=0; q<commSize; ++q )
-    {
-        Int index = sEntriesOffs[q];
-        const Int size = sRowSizes[q];
-        const Int off = sRowOffs[q];
-        for( Int s=0; s<size; ++s )
-        {
-            const Int i = sRows[s+off];
-            const Int iLoc = i-firstLocalRow;
-            const Int jReord = mappedSources[iLoc];
-            const Int rowOff = A.RowOffset( iLoc );
-            const Int numConnections = A.NumConnections( iLoc );
-            for( Int e=0; e<numConnections; ++e )
-            {
-                const Int iReord = mappedTargets[colOffs[rowOff+e]];
-                if( iReord >= jReord )
-                {
-                    const F value = A.Value( rowOff+e );
-                    sEntries[index] = (conjugate ? Conj(value) : value);
-                    sTargets[index] = iReord;
-                    ++index;
-                }
-            }
-        }
-        DEBUG_ONLY(
-          if( index != sEntriesOffs[q]+sEntriesSizes[q] )
-              LogicError("index was not the correct value");
-        )
-    }
-    if( time && commRank == 0 )
-        Output("Payload pack: ",timer.Stop()," secs");
+    Scan( sendSizes, sendOffs );
 
-    // Send back the number of nonzeros per row and the nonzeros themselves
-    if( time && commRank == 0 )
-        timer.Start();
-    vector<Int> rRowLengths( numRecvRows );
+    // Send back the number of nonzeros per row and their targets
+    rowLengths.resize( numRecvRows );
     mpi::AllToAll
     ( sRowLengths.data(), sRowSizes.data(), sRowOffs.data(),
-      rRowLengths.data(), rRowSizes.data(), rRowOffs.data(), comm );
-    vector<int> rEntriesSizes(commSize,0);
+      rowLengths.data(), rowSizes.data(), rowOffs.data(), comm );
+    recvSizes.assign( commSize, 0 );
     for( Int q=0; q<commSize; ++q )
     {
-        const Int size = rRowSizes[q];
-        const Int off = rRowOffs[q];
+        const Int size = rowSizes[q];
+        const Int off = rowOffs[q];
         for( Int s=0; s<size; ++s )
-            rEntriesSizes[q] += rRowLengths[off+s];
+            recvSizes[q] += rowLengths[off+s];
     }
-    vector<int> rEntriesOffs;
-    const int numRecvEntries = Scan( rEntriesSizes, rEntriesOffs );
-    vector<F> rEntries( numRecvEntries );
-    vector<Int> rTargets( numRecvEntries );
-    mpi::AllToAll
-    ( sEntries.data(), sEntriesSizes.data(), sEntriesOffs.data(),
-      rEntries.data(), rEntriesSizes.data(), rEntriesOffs.data(), comm );
+    const Int numRecvEntries = Scan( recvSizes, recvOffs );
+    targets.resize( numRecvEntries );
     mpi::AllToAll
-    ( sTargets.data(), sEntriesSizes.data(), sEntriesOffs.data(),
-      rTargets.data(), rEntriesSizes.data(), rEntriesOffs.data(), comm );
-    if( time && commRank == 0 )
-        Output("AllToAll time: ",timer.Stop()," secs");
+    ( sTargets.data(), sendSizes.data(), sendOffs.data(),
+      targets.data(), recvSizes.data(), recvOffs.data(), comm );
 
-    // Unpack the received entries
-    if( time && commRank == 0 )
-        timer.Start();
-    // TODO: Modify constructor of [Dist]Front to default to SYMM_2D?
-    type = SYMM_2D;
-    isHermitian = conjugate;
-    UnpackEntries
-    ( rootSep, rootInfo, *this, 
-      A, rRowLengths, rEntries, rTargets, rRowOffs, rEntriesOffs );
-    if( time && commRank == 0 )
-        Output("Unpack: ",timer.Stop()," secs");
+    initialized = true;
+}
+
+void DistFrontPullMeta::Empty()
+{
+    SwapClear( mappedSources );
+    SwapClear( mappedTargets );
+    SwapClear( colOffs );
+    SwapClear( rowSizes );
+    SwapClear( rowOffs );
+    SwapClear( rowLengths );
+    SwapClear( targets );
+    SwapClear( recvSizes );
+    SwapClear( recvOffs );
+    SwapClear( sendInds );
+    SwapClear( sendSizes );
+    SwapClear( sendOffs );
+    initialized = false;
 }
 
 template<typename F>
@@ -925,6 +979,13 @@ void DistFront<F>::Unpack
         }
         else
         {
+            // BLR fronts only store their bottom-left block in compressed form
+            Matrix<F> LBL;
+            if( front.LBLR.height != 0 )
+                Decompress( front.LBLR, LBL );
+            else
+                LockedView( LBL, front.LDense, IR(node.size,END), ALL );
+
             for( Int s=0; s<node.size; ++s )
             {
                 const Int i = node.off + s;
@@ -941,7 +1002,7 @@ void DistFront<F>::Unpack
                 const Int i = node.lowerStruct[s];
                 for( Int t=0; t<node.size; ++t )
                 {
-                    const F value = front.LDense(node.size+s,t);
+                    const F value = LBL.Get(s,t);
                     if( value != F(0) )
                         A.QueueUpdate( i, t+node.off, value );
                 }
@@ -1346,20 +1407,18 @@ void DistFront<F>::ComputeCommMeta
     const auto& FBR = childFront.work;
     const Int localHeight = FBR.LocalHeight();
     const Int localWidth = FBR.LocalWidth();
+    const Int colStride = L2D.ColStride();
+    vector<int> rowOwners( localHeight );
+    for( Int iChildLoc=0; iChildLoc<localHeight; ++iChildLoc )
+        rowOwners[iChildLoc] =
+          L2D.RowOwner( childRelInds[FBR.GlobalRow(iChildLoc)] );
     for( Int jChildLoc=0; jChildLoc<localWidth; ++jChildLoc )
     {
         const Int jChild = FBR.GlobalCol(jChildLoc);
-        const int j = childRelInds[jChild];
-        for( Int iChildLoc=0; iChildLoc<localHeight; ++iChildLoc )
-        {
-            const Int iChild = FBR.GlobalRow(iChildLoc);
-            if( iChild >= jChild )
-            {
-                const Int i = childRelInds[iChild];
-                const int q = L2D.Owner( i, j );
-                ++commMeta.numChildSendInds[q];
-            }
-        }
+        const int colOwner = L2D.ColOwner( childRelInds[jChild] )*colStride;
+        const Int iChildOff = FBR.LocalRowOffset( jChild );
+        for( Int iChildLoc=iChildOff; iChildLoc<localHeight; ++iChildLoc )
+            ++commMeta.numChildSendInds[rowOwners[iChildLoc]+colOwner];
     }
 
     // This is optional since it requires a nontrivial amount of storage.
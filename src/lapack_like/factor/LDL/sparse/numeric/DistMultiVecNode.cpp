@@ -91,6 +91,7 @@ void DistMultiVecNode<T>::Pull
 {
     DEBUG_CSE
     DistMultiVecNodeMeta meta;
+    meta.formGraphComms = false;
     Pull( invMap, info, X, meta );
 }
 
@@ -296,19 +297,8 @@ void DistMultiVecNode<T>::Pull
     // Reply with the values
     const Int numRecvInds = meta.mappedOwners.size();
     vector<T> recvVals( numRecvInds*width );
-    if( width != 1 )
-    {
-        for( int q=0; q<commSize; ++q )
-        {
-            meta.sendSizes[q] *= width;
-            meta.sendOffs[q] *= width;
-            meta.recvSizes[q] *= width;
-            meta.recvOffs[q] *= width;
-        }
-    }
-    mpi::AllToAll
-    ( sendVals.data(), meta.recvSizes.data(), meta.recvOffs.data(),
-      recvVals.data(), meta.sendSizes.data(), meta.sendOffs.data(), comm );
+    mpi::NeighborAllToAll
+    ( sendVals.data(), recvVals.data(), width, meta.pullPlan, comm );
     SwapClear( sendVals );
 
     // Unpack the values
@@ -321,15 +311,10 @@ void DistMultiVecNode<T>::Pull
     }
     else
     {
+        for( int q=0; q<commSize; ++q )
+            offs[q] *= width;
         PullUnpackMulti
         ( info, recvVals, meta.mappedOwners, *this, off, offs, width );
-        for( int q=0; q<commSize; ++q )
-        {
-            meta.sendSizes[q] /= width;
-            meta.sendOffs[q] /= width;
-            meta.recvSizes[q] /= width;
-            meta.recvOffs[q] /= width;
-        }
     }
     DEBUG_ONLY(
       if( off != numRecvInds )
@@ -451,6 +436,7 @@ void DistMultiVecNode<T>::Push
 {
     DEBUG_CSE
     DistMultiVecNodeMeta meta;
+    meta.formGraphComms = false;
     Push( invMap, info, X, meta );
 }
 
@@ -462,16 +448,10 @@ void DistMultiVecNodeMeta::Initialize
   const DistMultiVec<T>& X )
 {
     DEBUG_CSE
-    if( sendInds.size()     != 0 &&
-        recvInds.size()     != 0 &&
-        mappedOwners.size() != 0 &&
-        sendSizes.size()    != 0 &&
-        sendOffs.size()     != 0 &&
-        recvSizes.size()    != 0 &&
-        recvOffs.size()     != 0 )
-    {
+    // NOTE: The decision must be identical on every process since the
+    //       initialization (and the use of the plans) is collective
+    if( ready )
         return;
-    }
 
     const Int numSendInds = XNode.LocalHeight();
     mpi::Comm comm = info.comm;
@@ -578,6 +558,14 @@ void DistMultiVecNodeMeta::Initialize
     mpi::AllToAll
     ( sendInds.data(), sendSizes.data(), sendOffs.data(),
       recvInds.data(), recvSizes.data(), recvOffs.data(), comm );
+
+    mpi::BuildNeighborPlan
+    ( sendSizes, sendOffs, recvSizes, recvOffs, pushPlan, comm,
+      true, formGraphComms );
+    mpi::BuildNeighborPlan
+    ( recvSizes, recvOffs, sendSizes, sendOffs, pullPlan, comm,
+      true, formGraphComms );
+    ready = true;
 }
 
 template<typename T>
@@ -594,7 +582,6 @@ void DistMultiVecNode<T>::Push
     bool time = false;
 
     mpi::Comm comm = info.comm;
-    const int commSize = mpi::Size( comm );
     const int commRank = mpi::Rank( comm );
     X.SetComm( comm );
     X.Resize( height, width );
@@ -626,19 +613,8 @@ void DistMultiVecNode<T>::Push
     if( time && commRank == 0 )
         timer.Start();
     vector<T> recvVals( numRecvInds*width );
-    if( width != 1 )
-    {
-        for( int q=0; q<commSize; ++q )
-        {
-            meta.sendSizes[q] *= width;
-            meta.sendOffs[q] *= width;
-            meta.recvSizes[q] *= width;
-            meta.recvOffs[q] *= width;
-        }
-    }
-    mpi::AllToAll
-    ( sendVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
-      recvVals.data(), meta.recvSizes.data(), meta.recvOffs.data(), comm );
+    mpi::NeighborAllToAll
+    ( sendVals.data(), recvVals.data(), width, meta.pushPlan, comm );
     SwapClear( sendVals );
     if( time && commRank == 0 )
         Output("  send time: ",timer.Stop()," secs");
@@ -664,13 +640,6 @@ void DistMultiVecNode<T>::Push
             for( Int j=0; j<width; ++j )
                 XLoc(iLoc,j) = recvVals[s*width+j];
         }
-        for( int q=0; q<commSize; ++q )
-        {
-            meta.sendSizes[q] /= width;
-            meta.sendOffs[q] /= width;
-            meta.recvSizes[q] /= width;
-            meta.recvOffs[q] /= width;
-        }
     }
     if( time && commRank == 0 )
         Output("  unpack time: ",timer.Stop()," secs");
@@ -24,7 +24,8 @@ namespace ldl {
 
 template<typename F>
 Front<F>::Front( Front<F>* parentNode )
-: sparseLeaf(false), parent(parentNode), duplicate(nullptr)
+: sparseLeaf(false), workPredicted(0), workPeak(0),
+  parent(parentNode), duplicate(nullptr)
 { 
     if( parentNode != nullptr )
     {
@@ -35,7 +36,8 @@ Front<F>::Front( Front<F>* parentNode )
 
 template<typename F>
 Front<F>::Front( DistFront<F>* dupNode )
-: sparseLeaf(false), parent(nullptr), duplicate(dupNode)
+: sparseLeaf(false), workPredicted(0), workPeak(0),
+  parent(nullptr), duplicate(dupNode)
 {
     isHermitian = dupNode->isHermitian;
     type = dupNode->type;
@@ -47,7 +49,8 @@ Front<F>::Front
   const vector<Int>& reordering,
   const NodeInfo& info,
   bool conjugate )
-: sparseLeaf(false), parent(nullptr), duplicate(nullptr)
+: sparseLeaf(false), workPredicted(0), workPeak(0),
+  parent(nullptr), duplicate(nullptr)
 {
     DEBUG_CSE
     Pull( A, reordering, info, conjugate );
@@ -172,6 +175,7 @@ void Front<F>::Pull
         }
         else
         {
+            front.LBLR.Empty();
             Zeros( front.LDense, node.size+lowerSize, node.size );
             for( Int t=0; t<node.size; ++t )
             {
@@ -377,6 +381,13 @@ void Front<F>::Push
         }
         else
         {
+            // BLR fronts only store their bottom-left block in compressed form
+            Matrix<F> LBL;
+            if( front.LBLR.height != 0 )
+                Decompress( front.LBLR, LBL );
+            else
+                LockedView( LBL, front.LDense, IR(node.size,END), ALL );
+
             for( Int t=0; t<node.size; ++t )
             {
                 const Int j = invReorder[node.off+t];
@@ -394,7 +405,7 @@ void Front<F>::Push
                 for( Int s=0; s<lowerSize; ++s )
                 {
                     const Int i = invReorder[node.lowerStruct[s]];
-                    const F value = front.LDense(s+node.size,t);
+                    const F value = LBL.Get(s,t);
                     if( value != F(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -493,6 +504,13 @@ void Front<F>::Unpack( SparseMatrix<F>& A, const NodeInfo& rootInfo ) const
         }
         else
         {
+            // BLR fronts only store their bottom-left block in compressed form
+            Matrix<F> LBL;
+            if( front.LBLR.height != 0 )
+                Decompress( front.LBLR, LBL );
+            else
+                LockedView( LBL, front.LDense, IR(node.size,END), ALL );
+
             for( Int t=0; t<node.size; ++t )
             {
                 const Int j = node.off+t;
@@ -510,7 +528,7 @@ void Front<F>::Unpack( SparseMatrix<F>& A, const NodeInfo& rootInfo ) const
                 for( Int s=0; s<lowerSize; ++s )
                 {
                     const Int i = node.lowerStruct[s];
-                    const F value = front.LDense(s+node.size,t);
+                    const F value = LBL.Get(s,t);
                     if( value != F(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -530,11 +548,14 @@ const Front<F>& Front<F>::operator=( const Front<F>& front )
     type = front.type;
     LDense = front.LDense;
     LSparse = front.LSparse;
+    LBLR = front.LBLR;
     diag = front.diag;
     subdiag = front.subdiag;
     p = front.p;
     workDense = front.workDense;
     workSparse = front.workSparse;
+    workPredicted = front.workPredicted;
+    workPeak = front.workPeak;
     // Do not copy parent...
     // Delete any existing children
     for( auto* child : children )
@@ -551,7 +572,10 @@ const Front<F>& Front<F>::operator=( const Front<F>& front )
 
 template<typename F>
 Int Front<F>::Height() const
-{ return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height(); }
+{
+    return sparseLeaf ? LDense.Height()+LDense.Width()
+                      : LDense.Height()+LBLR.height;
+}
 
 template<typename F>
 Int Front<F>::NumEntries() const
@@ -586,6 +610,7 @@ Int Front<F>::NumEntries() const
         {
             // Add in L
             numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += front.LBLR.NumEntries();
         }
         // Add in the workspace for the Schur complement
         numEntries += front.workDense.Height()*front.workDense.Width(); 
@@ -647,7 +672,7 @@ Int Front<F>::NumBottomLeftEntries() const
         }
         else
         {
-            numEntries += (m-n)*n;
+            numEntries += (m-n)*n + front.LBLR.NumEntries();
         }
       };
     count( *this );
@@ -664,7 +689,8 @@ double Front<F>::FactorGFlops() const
       {
         for( auto* child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
+        const double m =
+          ( front.sparseLeaf ? front.LDense.Height() : front.Height() );
         const double n = front.LDense.Width();
         double realFrontFlops=0;
         if( front.sparseLeaf )
@@ -705,7 +731,8 @@ double Front<F>::SolveGFlops( Int numRHS ) const
       {
         for( auto* child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
+        const double m =
+          ( front.sparseLeaf ? front.LDense.Height() : front.Height() );
         const double n = front.LDense.Width();
         double realFrontFlops = 0;
         if( front.sparseLeaf ) 
@@ -47,8 +47,9 @@ void FrontLowerForwardMultiply( const Front<F>& front, Matrix<F>& W )
     DEBUG_CSE
     if( Unfactored(front.type) )
         LogicError("Cannot multiply against an unfactored front");
-    if( BlockFactorization(front.type) || PivotedFactorization(front.type) )
-        LogicError("Blocked and pivoted factorizations not supported");
+    if( BlockFactorization(front.type) || PivotedFactorization(front.type) ||
+        BLRFactorization(front.type) )
+        LogicError("Blocked, pivoted, and BLR factorizations not supported");
     if( front.sparseLeaf )
     {
         LogicError("Sparse leaves not supported in FrontLowerForwardMultiply");
@@ -21,12 +21,14 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_BACKWARD_HPP
 
 #include "./FrontBackward.hpp"
+#include "../Split.hpp"
 
 namespace El {
 namespace ldl {
 
+// Solve against a single front and set up the workspaces of its children
 template<typename F> 
-inline void LowerBackwardSolve
+inline void LowerBackwardSolveFront
 ( const NodeInfo& info, 
   const Front<F>& front,
         MatrixNode<F>& X, bool conjugate )
@@ -51,6 +53,8 @@ inline void LowerBackwardSolve
     if( haveParent || haveDupMVParent || haveDupMatParent )
         X.matrix = W( IR(0,info.size), IR(0,numRHS) );
 
+    const F* WBuf = W.LockedBuffer();
+    const Int WLDim = W.LDim();
     const Int numChildren = front.children.size();
     for( Int c=0; c<numChildren; ++c )
     {
@@ -62,13 +66,17 @@ inline void LowerBackwardSolve
         auto childWB = childW( IR(childSize,END), ALL );
         childWT = X.children[c]->matrix;
 
-        // Update the child's workspace
+        // Update the child's workspace, one column at a time
         const Int childUSize = childWB.Height();
-        for( Int iChild=0; iChild<childUSize; ++iChild )
+        const Int* relInds = info.childRelInds[c].data();
+        F* childUBuf = childWB.Buffer();
+        const Int childLDim = childWB.LDim();
+        for( Int j=0; j<numRHS; ++j )
         {
-            const Int i = info.childRelInds[c][iChild];
-            for( Int j=0; j<numRHS; ++j )
-                childWB(iChild,j) = W(i,j);
+            const F* WCol = &WBuf[j*WLDim];
+            F* childUCol = &childUBuf[j*childLDim];
+            for( Int iChild=0; iChild<childUSize; ++iChild )
+                childUCol[iChild] = WCol[relInds[iChild]];
         }
     }
     if( haveParent )
@@ -77,12 +85,87 @@ inline void LowerBackwardSolve
         dupMV->work.Empty();
     else if( haveDupMatParent )
         dupMat->work.Empty();
+}
 
+template<typename F> 
+inline void LowerBackwardSolveSequential
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate )
+{
+    DEBUG_CSE
+    LowerBackwardSolveFront( info, front, X, conjugate );
+    const Int numChildren = front.children.size();
     for( Int c=0; c<numChildren; ++c )
-        LowerBackwardSolve
+        LowerBackwardSolveSequential
         ( *info.children[c], *front.children[c], *X.children[c], conjugate );
 }
 
+#ifdef EL_HYBRID
+// Solve against the fronts above the independent subtrees with every thread
+// available to the dense kernels, and then against the subtrees
+// concurrently, one thread each
+template<typename F> 
+inline void LowerBackwardSolveTree
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate,
+  int numThreads )
+{
+    DEBUG_CSE
+    vector<Subtree<const Front<F>>> subtrees, top;
+    SplitTree( info, front, numThreads, SolveWork<F>, subtrees, top );
+
+    std::map<const NodeInfo*,MatrixNode<F>*> nodes;
+    MapNodes( info, X, nodes );
+
+    for( auto it=top.rbegin(); it!=top.rend(); ++it )
+        LowerBackwardSolveFront
+        ( *it->info, *it->front, *nodes.at(it->info), conjugate );
+
+    std::exception_ptr error;
+    const Int numSubtrees = subtrees.size();
+    #pragma omp parallel for schedule(dynamic,1)
+    for( Int t=0; t<numSubtrees; ++t )
+    {
+        try
+        {
+            const NodeInfo& subtreeInfo = *subtrees[t].info;
+            LowerBackwardSolveSequential
+            ( subtreeInfo, *subtrees[t].front, *nodes.at(&subtreeInfo),
+              conjugate );
+        }
+        catch( ... )
+        {
+            #pragma omp critical
+            error = std::current_exception();
+        }
+    }
+    if( error )
+        std::rethrow_exception( error );
+}
+#endif // ifdef EL_HYBRID
+
+template<typename F> 
+inline void LowerBackwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate )
+{
+    DEBUG_CSE
+#ifdef EL_HYBRID
+    // Only split the tree from outside of a parallel region so that nested
+    // calls (and single-threaded runs) fall back to the sequential traversal
+    const int numThreads = omp_get_max_threads();
+    if( numThreads > 1 && !omp_in_parallel() )
+    {
+        LowerBackwardSolveTree( info, front, X, conjugate, numThreads );
+        return;
+    }
+#endif
+    LowerBackwardSolveSequential( info, front, X, conjugate );
+}
+
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
@@ -116,8 +199,9 @@ inline void LowerBackwardSolve
     )
     const Grid& childGrid =
       ( frontIs1D ? childFront.L1D.Grid() : childFront.L2D.Grid() );
+    // The factor of a BLR duplicate only holds its top-left block
     const Int childFrontHeight =
-      ( frontIs1D ? childFront.L1D.Height() : childFront.L2D.Height() );
+      info.child->size + info.child->lowerStruct.size();
     auto& childW = X.child->work;
     childW.SetGrid( childGrid );
     childW.Resize( childFrontHeight, numRHS );
@@ -218,7 +302,8 @@ inline void LowerBackwardSolve
           LogicError("Incompatible front type mixture");
     )
     const Grid& childGrid = childFront.L2D.Grid();
-    const Int childFrontHeight = childFront.L2D.Height();
+    const Int childFrontHeight =
+      info.child->size + info.child->lowerStruct.size();
     auto& childW = X.child->work;
     childW.SetGrid( childGrid );
     childW.Align( 0, 0 );
@@ -21,23 +21,21 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_FORWARD_HPP
 
 #include "./FrontForward.hpp"
+#include "../Split.hpp"
 
 namespace El {
 namespace ldl {
 
+// Solve against a single front once its children have been solved against,
+// consuming their workspaces
 template<typename F> 
-void LowerForwardSolve
+void LowerForwardSolveFront
 ( const NodeInfo& info, 
   const Front<F>& front,
         MatrixNode<F>& X )
 {
     DEBUG_CSE
 
-    const Int numChildren = info.children.size();
-    for( Int c=0; c<numChildren; ++c )
-        LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
-
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
     //       (or a duplicate's parent)
@@ -49,20 +47,24 @@ void LowerForwardSolve
     WT = X.matrix;
     Zero( WB );
 
-    // Update using the children (if they exist)
+    // Update using the children (if they exist), one column at a time
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    const Int numChildren = info.children.size();
     for( Int c=0; c<numChildren; ++c )
     {
         auto& childW = X.children[c]->work;
         const Int childSize = info.children[c]->size;
-        const Int childHeight = childW.Height();
-        const Int childUSize = childHeight-childSize;
-
-        auto childU = childW( IR(childSize,childHeight), IR(0,numRHS) );
-        for( Int iChild=0; iChild<childUSize; ++iChild )
+        const Int childUSize = childW.Height()-childSize;
+        const Int* relInds = info.childRelInds[c].data();
+        const F* childUBuf = childW.LockedBuffer() + childSize;
+        const Int childLDim = childW.LDim();
+        for( Int j=0; j<numRHS; ++j )
         {
-            const Int iFront = info.childRelInds[c][iChild]; 
-            for( Int j=0; j<numRHS; ++j )
-                W(iFront,j) += childU(iChild,j);
+            F* WCol = &WBuf[j*WLDim];
+            const F* childUCol = &childUBuf[j*childLDim];
+            for( Int iChild=0; iChild<childUSize; ++iChild )
+                WCol[relInds[iChild]] += childUCol[iChild];
         }
         childW.Empty();
     }
@@ -74,6 +76,84 @@ void LowerForwardSolve
     X.matrix = WT;
 }
 
+template<typename F> 
+void LowerForwardSolveSequential
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X )
+{
+    DEBUG_CSE
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        LowerForwardSolveSequential
+        ( *info.children[c], *front.children[c], *X.children[c] );
+    LowerForwardSolveFront( info, front, X );
+}
+
+#ifdef EL_HYBRID
+// Solve against the independent subtrees concurrently, one thread each, and
+// then against the fronts above them with every thread available to the
+// dense kernels
+template<typename F> 
+void LowerForwardSolveTree
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X,
+  int numThreads )
+{
+    DEBUG_CSE
+    vector<Subtree<const Front<F>>> subtrees, top;
+    SplitTree( info, front, numThreads, SolveWork<F>, subtrees, top );
+
+    std::map<const NodeInfo*,MatrixNode<F>*> nodes;
+    MapNodes( info, X, nodes );
+
+    std::exception_ptr error;
+    const Int numSubtrees = subtrees.size();
+    #pragma omp parallel for schedule(dynamic,1)
+    for( Int t=0; t<numSubtrees; ++t )
+    {
+        try
+        {
+            const NodeInfo& subtreeInfo = *subtrees[t].info;
+            LowerForwardSolveSequential
+            ( subtreeInfo, *subtrees[t].front, *nodes.at(&subtreeInfo) );
+        }
+        catch( ... )
+        {
+            #pragma omp critical
+            error = std::current_exception();
+        }
+    }
+    if( error )
+        std::rethrow_exception( error );
+
+    for( const auto& subtree : top )
+        LowerForwardSolveFront
+        ( *subtree.info, *subtree.front, *nodes.at(subtree.info) );
+}
+#endif // ifdef EL_HYBRID
+
+template<typename F> 
+void LowerForwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X )
+{
+    DEBUG_CSE
+#ifdef EL_HYBRID
+    // Only split the tree from outside of a parallel region so that nested
+    // calls (and single-threaded runs) fall back to the sequential traversal
+    const int numThreads = omp_get_max_threads();
+    if( numThreads > 1 && !omp_in_parallel() )
+    {
+        LowerForwardSolveTree( info, front, X, numThreads );
+        return;
+    }
+#endif
+    LowerForwardSolveSequential( info, front, X );
+}
+
 template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
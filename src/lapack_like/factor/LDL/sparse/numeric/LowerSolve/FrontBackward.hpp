@@ -104,6 +104,35 @@ void FrontVanillaLowerBackwardSolve
     Trsm( LEFT, LOWER, orientation, UNIT, F(1), LT, XT, true );
 }
 
+template<typename F>
+void FrontBLRLowerBackwardSolve
+( const Matrix<F>& L,
+  const BLRMatrix<F>& LBL,
+        Matrix<F>& X,
+  bool conjugate )
+{
+    DEBUG_CSE
+    if( LBL.height == 0 )
+    {
+        // The front was left dense
+        FrontVanillaLowerBackwardSolve( L, X, conjugate );
+        return;
+    }
+    DEBUG_ONLY(
+      if( L.Height() != L.Width() || L.Height()+LBL.height != X.Height() )
+          LogicError
+          ("Nonconformal solve:\n",
+           DimsString(L,"L"),"\n",DimsString(X,"X"));
+    )
+    const Int n = L.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    Multiply( orientation, F(-1), LBL, XB, F(1), XT );
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), L, XT, true );
+}
+
 template<typename F>
 void FrontIntraPivLowerBackwardSolve
 ( const Matrix<F>& L,
@@ -691,6 +720,9 @@ void FrontLowerBackwardSolve
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerBackwardSolve
             ( front.LDense, front.p, W, conjugate );
+        else if( BLRFactorization(type) )
+            FrontBLRLowerBackwardSolve
+            ( front.LDense, front.LBLR, W, conjugate );
         else
             FrontVanillaLowerBackwardSolve( front.LDense, W, conjugate );
     }
@@ -710,7 +742,7 @@ void FrontLowerBackwardSolve
     )
     const bool blocked = BlockFactorization(type);
 
-    if( type == LDL_2D )
+    if( type == LDL_2D || type == LDL_BLR_2D )
         FrontVanillaLowerBackwardSolve( front.L2D, W, conjugate );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerBackwardSolve( front.L2D, W, conjugate );
@@ -740,9 +772,9 @@ void FrontLowerBackwardSolve
     )
     const bool blocked = BlockFactorization(type);
 
-    if( type == LDL_1D )
+    if( type == LDL_1D || type == LDL_BLR_1D )
         FrontVanillaLowerBackwardSolve( front.L1D, W, conjugate );
-    else if( type == LDL_2D )
+    else if( type == LDL_2D || type == LDL_BLR_2D )
         FrontVanillaLowerBackwardSolve( front.L2D, W, conjugate );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerBackwardSolve( front.L1D, W, conjugate );
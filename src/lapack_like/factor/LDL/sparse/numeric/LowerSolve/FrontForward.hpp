@@ -86,6 +86,33 @@ void FrontBlockLowerForwardSolve
     Gemm( NORMAL, NORMAL, F(-1), LB, XT, F(1), XB );
 }
 
+template<typename F>
+void FrontBLRLowerForwardSolve
+( const Matrix<F>& L,
+  const BLRMatrix<F>& LBL,
+        Matrix<F>& X )
+{
+    DEBUG_CSE
+    if( LBL.height == 0 )
+    {
+        // The front was left dense
+        FrontVanillaLowerForwardSolve( L, X );
+        return;
+    }
+    DEBUG_ONLY(
+      if( L.Height() != L.Width() || L.Height()+LBL.height != X.Height() )
+          LogicError
+          ("Nonconformal solve:\n",
+           DimsString(L,"L"),"\n",DimsString(X,"X"));
+    )
+    const Int n = L.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L, XT );
+    Multiply( NORMAL, F(-1), LBL, XT, F(1), XB );
+}
+
 template<typename F>
 void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
 {
@@ -119,6 +146,8 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
             FrontBlockLowerForwardSolve( front.LDense, W );
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerForwardSolve( front.LDense, front.p, W );
+        else if( BLRFactorization(type) )
+            FrontBLRLowerForwardSolve( front.LDense, front.LBLR, W );
         else
             FrontVanillaLowerForwardSolve( front.LDense, W );
     }
@@ -666,9 +695,9 @@ FrontLowerForwardSolve
     const LDLFrontType type = front.type;
 
     // TODO: Add support for LDL_2D
-    if( type == LDL_1D )
+    if( type == LDL_1D || type == LDL_BLR_1D )
         FrontVanillaLowerForwardSolve( front.L1D, W );
-    else if( type == LDL_2D )
+    else if( type == LDL_2D || type == LDL_BLR_2D )
         FrontVanillaLowerForwardSolve( front.L2D, W );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerForwardSolve( front.L1D, W );
@@ -693,7 +722,7 @@ FrontLowerForwardSolve( const DistFront<F>& front, DistMatrix<F>& W )
     DEBUG_CSE
     const LDLFrontType type = front.type;
 
-    if( type == LDL_2D )
+    if( type == LDL_2D || type == LDL_BLR_2D )
         FrontVanillaLowerForwardSolve( front.L2D, W );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerForwardSolve( front.L2D, W );
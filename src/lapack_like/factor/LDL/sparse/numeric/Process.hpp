@@ -21,97 +21,262 @@
 #define EL_LDL_PROCESS_HPP
 
 #include "./ProcessFront.hpp"
+#include "./Split.hpp"
 
 namespace El {
 namespace ldl {
 
-template<typename F> 
-inline void 
-Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+namespace process {
+
+// Workspace for the update matrices of a postordered traversal of (part of)
+// the elimination tree, as well as for the temporaries of its sparse leaves.
+// The update matrix of each front is pushed just before the front is
+// processed and popped as soon as it has been added into its parent, so
+// that only the top of the stack is ever in use.
+template<typename F>
+struct UpdateStack
+{
+    F* buffer;
+    Int* intBuffer;
+    Int size, offset, peak;
+
+    UpdateStack( F* buf=nullptr, Int* intBuf=nullptr, Int bufSize=0 )
+    : buffer(buf), intBuffer(intBuf), size(bufSize), offset(0), peak(0)
+    { }
+
+    F* Push( Int numEntries )
+    {
+        DEBUG_ONLY(
+          if( offset+numEntries > size )
+              LogicError
+              ("Pushing ",numEntries," entries would overflow the stack");
+        )
+        F* ptr = &buffer[offset];
+        offset += numEntries;
+        peak = Max( peak, offset );
+        return ptr;
+    }
+
+    void Pop( Int numEntries ) { offset -= numEntries; }
+};
+
+// The number of entries of the stack needed to process the subtree rooted
+// at the given front, not counting the front's own update matrix
+template<typename F>
+inline Int StackSize( const NodeInfo& info, const Front<F>& front )
+{
+    if( front.sparseLeaf )
+    {
+        // The dense accumulator and then a copy of the bottom-left block
+        const Int numSources = info.LOffsets.size()-1;
+        return Max( numSources, front.LDense.Height()*front.LDense.Width() );
+    }
+    Int size = 0;
+    const int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const NodeInfo& childInfo = *info.children[c];
+        const Int updateSize = childInfo.lowerStruct.size();
+        size =
+          Max
+          ( size,
+            updateSize*updateSize + StackSize(childInfo,*front.children[c]) );
+    }
+    return size;
+}
+
+// The number of integers needed by the sparse leaves of the subtree
+template<typename F>
+inline Int IntStackSize( const NodeInfo& info, const Front<F>& front )
+{
+    if( front.sparseLeaf )
+        return 3*(info.LOffsets.size()-1);
+    Int size = 0;
+    const int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        size = Max( size, IntStackSize(*info.children[c],*front.children[c]) );
+    return size;
+}
+
+} // namespace process
+
+// Place the (zeroed) update matrix of the front on top of the stack
+template<typename F>
+inline void PushUpdate
+( const NodeInfo& info, Front<F>& front, process::UpdateStack<F>& stack )
 {
     DEBUG_CSE
-    const int updateSize = info.lowerStruct.size();
+    const Int updateSize = info.lowerStruct.size();
     auto& FBR = front.workDense;
     FBR.Empty();
-    Zeros( FBR, updateSize, updateSize );
+    FBR.Attach
+    ( updateSize, updateSize, stack.Push(updateSize*updateSize),
+      Max(updateSize,1) );
+    Zero( FBR );
+}
 
-    if( front.sparseLeaf )
+template<typename F>
+inline void
+ProcessSparseLeaf
+( const NodeInfo& info,
+  Front<F>& front,
+  LDLFrontType factorType,
+  process::UpdateStack<F>& stack )
+{
+    DEBUG_CSE
+    front.type = factorType;
+    const Int m = front.LDense.Height();
+    const Int n = front.LDense.Width();
+    const Int numEntries = info.LOffsets.back();
+    const Int numSources = info.LOffsets.size()-1;
+
+    // TODO(poulson): Add support for pivoting here
+    if( PivotedFactorization(factorType) )
+        Zeros( front.subdiag, Max(n-1,0), 1 );
+
+    Zeros( front.LSparse, numSources, numSources );
+    front.LSparse.ForceNumEntries( numEntries );
+    F* LValBuf = front.LSparse.ValueBuffer();
+    Int* LRowBuf = front.LSparse.SourceBuffer();
+    Int* LColBuf = front.LSparse.TargetBuffer();
+    Int* LOffsetBuf = front.LSparse.OffsetBuffer();
+
+    for( Int i=0; i<numSources; ++i )
     {
-        front.type = factorType;
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
-        const Int numEntries = info.LOffsets.back();
-        const Int numSources = info.LOffsets.size()-1;
+        const Int iStart = info.LOffsets[i];
+        const Int iEnd = info.LOffsets[i+1];
+        LOffsetBuf[i] = iStart;
+        for( Int e=iStart; e<iEnd; ++e )
+            LRowBuf[e] = i;
+    }
+    LOffsetBuf[numSources] = info.LOffsets[numSources];
+    front.diag.Resize( numSources, 1 );
 
-        // TODO(poulson): Add support for pivoting here
-        if( PivotedFactorization(factorType) )
-            Zeros( front.subdiag, Max(n-1,0), 1 );
+    // Factor the transpose of L using workspace from the top of the stack
+    Int* LNnz = stack.intBuffer;
+    Int* pattern = &LNnz[numSources];
+    Int* flag = &pattern[numSources];
+    F* y = stack.Push( numSources );
+    suite_sparse::ldl::Numeric
+    ( numSources,
+      front.workSparse.LockedOffsetBuffer(),
+      front.workSparse.LockedTargetBuffer(),
+      front.workSparse.LockedValueBuffer(),
+      LOffsetBuf,
+      info.LParents.data(),
+      LNnz,
+      LColBuf,
+      LValBuf,
+      front.diag.Buffer(),
+      y,
+      pattern,
+      flag,
+      (const Int*)nullptr,
+      (const Int*)nullptr,
+      front.isHermitian );
+    front.LSparse.ForceConsistency();
+    stack.Pop( numSources );
 
-        Zeros( front.LSparse, numSources, numSources );
-        front.LSparse.ForceNumEntries( numEntries );
-        F* LValBuf = front.LSparse.ValueBuffer();
-        Int* LRowBuf = front.LSparse.SourceBuffer();
-        Int* LColBuf = front.LSparse.TargetBuffer();
-        Int* LOffsetBuf = front.LSparse.OffsetBuffer();
+    // Solve against L_{TL}^T from the right
+    bool onLeft = false;
+    suite_sparse::ldl::LTSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
 
-        for( Int i=0; i<numSources; ++i )
-        {
-            const Int iStart = info.LOffsets[i];
-            const Int iEnd = info.LOffsets[i+1];
-            LOffsetBuf[i] = iStart;
-            for( Int e=iStart; e<iEnd; ++e )
-                LRowBuf[e] = i;
-        }
-        LOffsetBuf[numSources] = info.LOffsets[numSources];
-        front.diag.Resize( numSources, 1 );
-
-        // Factor the transpose of L
-        // TODO: Reuse these workspaces
-        vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
-        vector<F> y(numSources);
-        suite_sparse::ldl::Numeric
-        ( numSources,
-          front.workSparse.LockedOffsetBuffer(),
-          front.workSparse.LockedTargetBuffer(),
-          front.workSparse.LockedValueBuffer(),
-          LOffsetBuf,
-          info.LParents.data(),
-          LNnz.data(),
-          LColBuf,
-          LValBuf,
-          front.diag.Buffer(),
-          y.data(),
-          pattern.data(),
-          flag.data(),
-          (const Int*)nullptr,
-          (const Int*)nullptr,
-          front.isHermitian );
-        front.LSparse.ForceConsistency();
-
-        // Solve against L_{TL}^T from the right
-        bool onLeft = false;
-        suite_sparse::ldl::LTSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
-
-        // Save a copy of ABL
-        auto ABLCopy = front.LDense;
-
-        // Solve against the diagonal
-        suite_sparse::ldl::DSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          front.diag.Buffer() );
-
-        // Form the Schur complement
-        Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
-        Trrk
-        ( LOWER, NORMAL, orientation,
-          F(-1), front.LDense, ABLCopy, F(0), front.workDense );
+    // Save a copy of ABL
+    Matrix<F> ABLCopy;
+    ABLCopy.Attach( m, n, stack.Push(m*n), Max(m,1) );
+    ABLCopy = front.LDense;
+
+    // Solve against the diagonal
+    suite_sparse::ldl::DSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      front.diag.Buffer() );
+
+    // Form the Schur complement
+    Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
+    Trrk
+    ( LOWER, NORMAL, orientation,
+      F(-1), front.LDense, ABLCopy, F(0), front.workDense );
+    stack.Pop( m*n );
+}
+
+// Add the update matrix of the c'th child into the front and release it.
+// The relative indices of the child are increasing, so they are broken into
+// runs of consecutive indices, each of which is added with a contiguous
+// (vectorizable) loop, and the columns are split once at the boundary
+// between the left and bottom-right portions of the front.
+template<typename F>
+inline void ExtendAdd( const NodeInfo& info, Front<F>& front, Int c )
+{
+    DEBUG_CSE
+    auto& childU = front.children[c]->workDense;
+    const Int childUSize = childU.Height();
+    const Int* relInds = info.childRelInds[c].data();
+    const F* UBuf = childU.LockedBuffer();
+    const Int ULDim = childU.LDim();
+
+    // runEnds[k] is one past the end of the run containing index k
+    vector<Int> runEnds( childUSize );
+    for( Int k=childUSize-1; k>=0; --k )
+        runEnds[k] =
+          ( k+1 < childUSize && relInds[k+1] == relInds[k]+1 ?
+            runEnds[k+1] : k+1 );
+
+    // Add the lower triangle of columns [jBeg,jEnd) of the child update into
+    // the matrix whose (i,j) entry lives at ABuf[(i-offset)+(j-offset)*ALDim]
+    auto addColumns =
+      [&]( Int jBeg, Int jEnd, F* ABuf, Int ALDim, Int offset )
+      {
+          for( Int jChild=jBeg; jChild<jEnd; ++jChild )
+          {
+              F* ACol = &ABuf[(relInds[jChild]-offset)*ALDim];
+              const F* UCol = &UBuf[jChild*ULDim];
+              for( Int iChild=jChild; iChild<childUSize; )
+              {
+                  const Int runEnd = runEnds[iChild];
+                  F* ARun = &ACol[relInds[iChild]-offset];
+                  const F* URun = &UCol[iChild];
+                  const Int runSize = runEnd-iChild;
+                  for( Int k=0; k<runSize; ++k )
+                      ARun[k] += URun[k];
+                  iChild = runEnd;
+              }
+          }
+      };
+    const Int numLeft =
+      std::lower_bound( relInds, relInds+childUSize, info.size ) - relInds;
+    auto& FL = front.LDense;
+    auto& FBR = front.workDense;
+    addColumns( 0, numLeft, FL.Buffer(), FL.LDim(), 0 );
+    addColumns( numLeft, childUSize, FBR.Buffer(), FBR.LDim(), info.size );
+
+    // The update matrix was a view into the stack
+    childU.Empty();
+    childU.SetViewType( OWNER );
+}
+
+// Process the subtree rooted at a front whose update matrix is already in
+// place, pushing the updates of its descendants onto the stack
+template<typename F>
+inline void
+ProcessSequential
+( const NodeInfo& info,
+  Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl,
+  process::UpdateStack<F>& stack )
+{
+    DEBUG_CSE
+    if( front.sparseLeaf )
+    {
+        ProcessSparseLeaf( info, front, factorType, stack );
     }
     else
     {
-        auto& FL = front.LDense;
         DEBUG_ONLY(
+          const Int updateSize = info.lowerStruct.size();
+          auto& FL = front.LDense;
           if( FL.Height() != info.size+updateSize || FL.Width() != info.size )
               LogicError("Front was not the proper size");
         )
@@ -120,33 +285,190 @@ Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            const NodeInfo& childInfo = *info.children[c];
+            Front<F>& childFront = *front.children[c];
+            PushUpdate( childInfo, childFront, stack );
+            ProcessSequential
+            ( childInfo, childFront, factorType, blrCtrl, stack );
+            ExtendAdd( info, front, c );
+            const Int childUpdateSize = childInfo.lowerStruct.size();
+            stack.Pop( childUpdateSize*childUpdateSize );
+        }
+        ProcessFront( front, factorType, blrCtrl );
+    }
+}
 
-            auto& childU = front.children[c]->workDense;
-            const int childUSize = childU.Height();
-            for( int jChild=0; jChild<childUSize; ++jChild )
-            {
-                const int j = info.childRelInds[c][jChild];
-                for( int iChild=jChild; iChild<childUSize; ++iChild )
-                {
-                    const int i = info.childRelInds[c][iChild];
-                    const F value = childU(iChild,jChild);
-                    if( j < info.size )
-                        FL(i,j) += value;
-                    else
-                        FBR(i-info.size,j-info.size) += value;
-                }
-            }
-            childU.Empty();
+#ifdef EL_HYBRID
+namespace process {
+
+// A rough count of the (real) flops required to factor a single front,
+// mirroring Front<F>::FactorGFlops
+template<typename F>
+inline double FrontWork( const NodeInfo& info, const Front<F>& front )
+{
+    const double n = info.size;
+    const double m = info.lowerStruct.size();
+    double work = 0;
+    if( front.sparseLeaf )
+    {
+        const Int numSources = info.LOffsets.size()-1;
+        for( Int j=0; j<numSources; ++j )
+        {
+            const double nnz = info.LOffsets[j+1]-info.LOffsets[j];
+            work += nnz*(nnz+2.);
         }
-        ProcessFront( front, factorType );
+        work += m*n + m*m*n;
     }
+    else
+        work = n*n*n/3 + m*n*n + m*m*n;
+    return work;
+}
+
+} // namespace process
+
+template<typename F>
+inline void
+ProcessTree
+( const NodeInfo& info,
+  Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl,
+  int numThreads )
+{
+    DEBUG_CSE
+    vector<Subtree<Front<F>>> subtrees, top;
+    SplitTree( info, front, numThreads, process::FrontWork<F>, subtrees, top );
+
+    // Give each subtree its own stack, with the update matrix of its root
+    // at the bottom so that it survives until the parent is processed, and
+    // carve all of the stacks (and the updates of the fronts above the
+    // subtrees) out of a single allocation
+    const Int numSubtrees = subtrees.size();
+    vector<Int> sizes(numSubtrees+1), intSizes(numSubtrees+1,0);
+    for( Int t=0; t<numSubtrees; ++t )
+    {
+        const NodeInfo& subtreeInfo = *subtrees[t].info;
+        const Front<F>& subtreeFront = *subtrees[t].front;
+        sizes[t] = process::StackSize( subtreeInfo, subtreeFront );
+        intSizes[t] = process::IntStackSize( subtreeInfo, subtreeFront );
+        if( &subtreeInfo != &info )
+        {
+            const Int updateSize = subtreeInfo.lowerStruct.size();
+            sizes[t] += updateSize*updateSize;
+        }
+    }
+    sizes[numSubtrees] = 0;
+    for( const auto& subtree : top )
+    {
+        if( subtree.info != &info )
+        {
+            const Int updateSize = subtree.info->lowerStruct.size();
+            sizes[numSubtrees] += updateSize*updateSize;
+        }
+    }
+    vector<Int> offs, intOffs;
+    const Int totalSize = Scan( sizes, offs );
+    const Int totalIntSize = Scan( intSizes, intOffs );
+    vector<F> buffer;
+    vector<Int> intBuffer;
+    FastResize( buffer, totalSize );
+    FastResize( intBuffer, totalIntSize );
+    vector<process::UpdateStack<F>> stacks;
+    for( Int t=0; t<=numSubtrees; ++t )
+        stacks.emplace_back
+        ( buffer.data()+offs[t], intBuffer.data()+intOffs[t], sizes[t] );
+
+    // Factor the independent subtrees concurrently. The dense kernels called
+    // within the parallel region run on a single thread each.
+    std::exception_ptr error;
+    #pragma omp parallel for schedule(dynamic,1)
+    for( Int t=0; t<numSubtrees; ++t )
+    {
+        try
+        {
+            const NodeInfo& subtreeInfo = *subtrees[t].info;
+            Front<F>& subtreeFront = *subtrees[t].front;
+            if( &subtreeInfo != &info )
+                PushUpdate( subtreeInfo, subtreeFront, stacks[t] );
+            ProcessSequential
+            ( subtreeInfo, subtreeFront, factorType, blrCtrl, stacks[t] );
+        }
+        catch( ... )
+        {
+            #pragma omp critical
+            error = std::current_exception();
+        }
+    }
+    if( error )
+        std::rethrow_exception( error );
+
+    // Factor the remaining fronts, leaving the threads to the dense kernels
+    auto& topStack = stacks[numSubtrees];
+    for( const auto& subtree : top )
+    {
+        const NodeInfo& topInfo = *subtree.info;
+        Front<F>& topFront = *subtree.front;
+        if( &topInfo != &info )
+            PushUpdate( topInfo, topFront, topStack );
+        const int numChildren = topInfo.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            ExtendAdd( topInfo, topFront, c );
+        ProcessFront( topFront, factorType, blrCtrl );
+    }
+
+    front.workPredicted += totalSize;
+    for( const auto& stack : stacks )
+        front.workPeak += stack.peak;
+}
+#endif // ifdef EL_HYBRID
+
+template<typename F> 
+inline void 
+Process
+( const NodeInfo& info,
+  Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl )
+{
+    DEBUG_CSE
+    // The update matrix of the root outlives the factorization (the
+    // distributed factorization consumes it), so it is not on the stack
+    const Int updateSize = info.lowerStruct.size();
+    auto& FBR = front.workDense;
+    FBR.Empty();
+    Zeros( FBR, updateSize, updateSize );
+    front.workPredicted = front.workPeak = updateSize*updateSize;
+
+#ifdef EL_HYBRID
+    // Only split the tree from outside of a parallel region so that nested
+    // calls (and single-threaded runs) fall back to the sequential traversal
+    const int numThreads = omp_get_max_threads();
+    if( numThreads > 1 && !omp_in_parallel() )
+    {
+        ProcessTree( info, front, factorType, blrCtrl, numThreads );
+        return;
+    }
+#endif
+
+    // Make a single allocation for all of the update matrices
+    const Int stackSize = process::StackSize( info, front );
+    vector<F> buffer;
+    vector<Int> intBuffer;
+    FastResize( buffer, stackSize );
+    FastResize( intBuffer, process::IntStackSize(info,front) );
+    process::UpdateStack<F> stack( buffer.data(), intBuffer.data(), stackSize );
+    ProcessSequential( info, front, factorType, blrCtrl, stack );
+    front.workPredicted += stackSize;
+    front.workPeak += stack.peak;
 }
 
 template<typename F>
 inline void
 Process
-( const DistNodeInfo& info, DistFront<F>& front, LDLFrontType factorType )
+( const DistNodeInfo& info,
+  DistFront<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl )
 {
     DEBUG_CSE
 
@@ -156,10 +478,12 @@ Process
         const Grid& grid = *info.grid;
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        Process( *info.duplicate, frontDup, factorType, blrCtrl );
 
-        // Pull the relevant information up from the duplicate
+        // Pull the relevant information up from the duplicate (a BLR
+        // factorization replaces its dense factor by the top-left block)
         front.type = frontDup.type;
+        front.L2D.Attach( grid, frontDup.LDense );
         front.work.LockedAttach( grid, frontDup.workDense );
         if( !BlockFactorization(factorType) )
         {
@@ -177,7 +501,7 @@ Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+    Process( childInfo, childFront, factorType, blrCtrl );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
@@ -187,8 +511,11 @@ Process
           LogicError("Front was not the proper size");
     )
 
-    // Compute the metadata for sharing child updates
-    front.ComputeCommMeta( info, true );
+    // Compute the metadata for sharing child updates unless it was kept from
+    // a previous factorization of the same structure
+    if( front.commMeta.numChildSendInds.empty() ||
+        front.commMeta.childRecvInds.empty() )
+        front.ComputeCommMeta( info, true );
     mpi::Comm comm = front.L2D.DistComm();
     const int commSize = mpi::Size( comm );
     const auto& childU = childFront.work;
@@ -205,20 +532,30 @@ Process
     // Pack the updates
     vector<F> sendBuf( sendBufSize );
     const Int myChild = ( childInfo.onLeft ? 0 : 1 );
+    // The owner of entry (i,j) of the front is the sum of a contribution from
+    // the row and one from the column, so look each up once per local row
+    // and column of the update rather than once per entry
     auto offs = sendOffs;
+    const auto& relInds = info.childRelInds[myChild];
     const Int updateLocHeight = childU.LocalHeight();
     const Int updateLocWidth = childU.LocalWidth();
+    const Int colStride = front.L2D.ColStride();
+    vector<int> rowOwners( updateLocHeight );
+    for( Int iChildLoc=0; iChildLoc<updateLocHeight; ++iChildLoc )
+        rowOwners[iChildLoc] =
+          front.L2D.RowOwner( relInds[childU.GlobalRow(iChildLoc)] );
+    const F* childUBuf = childU.LockedBuffer();
+    const Int childULDim = childU.LDim();
     for( Int jChildLoc=0; jChildLoc<updateLocWidth; ++jChildLoc )
     {
         const Int jChild = childU.GlobalCol(jChildLoc);
-        const Int j = info.childRelInds[myChild][jChild];
+        const int colOwner = front.L2D.ColOwner( relInds[jChild] )*colStride;
         const Int iChildOff = childU.LocalRowOffset( jChild );
+        const F* childUCol = &childUBuf[jChildLoc*childULDim];
         for( Int iChildLoc=iChildOff; iChildLoc<updateLocHeight; ++iChildLoc )
         {
-            const Int iChild = childU.GlobalRow(iChildLoc);
-            const Int i = info.childRelInds[myChild][iChild];
-            const int q = front.L2D.Owner( i, j );
-            sendBuf[offs[q]++] = childU.GetLocal(iChildLoc,jChildLoc);
+            const int q = rowOwners[iChildLoc] + colOwner;
+            sendBuf[offs[q]++] = childUCol[iChildLoc];
         }
     }
     DEBUG_ONLY(
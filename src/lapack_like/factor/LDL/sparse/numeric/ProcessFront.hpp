@@ -150,8 +150,101 @@ void ProcessFrontBlock
     }
 }
 
+// Factor the top-left block of the front densely and compress the resulting
+// bottom-left block of L before forming the Schur complement from its tiles,
+// so that each pair of low-rank tiles only contributes through their ranks
 template<typename F>
-void ProcessFront( Front<F>& front, LDLFrontType factorType )
+void ProcessFrontBLR
+( Matrix<F>& AL,
+  Matrix<F>& ABR,
+  BLRMatrix<F>& LBL,
+  bool conjugate,
+  const BLRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = AL.Width();
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    auto ATL = AL( IR(0,n  ), ALL );
+    auto ABL = AL( IR(n,END), ALL );
+
+    LDL( ATL, conjugate );
+    auto d = GetDiagonal( ATL );
+    Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
+    DiagonalSolve( RIGHT, NORMAL, d, ABL );
+    Compress( ABL, LBL, ctrl );
+
+    // Only keep the top-left block densely
+    Matrix<F> ATLCopy( ATL );
+    AL = std::move( ATLCopy );
+
+    // ABR(I,J) -= L(I,K) D(K) op(L(J,K)) for each tile K of columns, where
+    // op(L(J,K)) is formed as op(V(J,K)) op(U(J,K)) when L(J,K) is low-rank
+    const Int numTileRows = LBL.NumTileRows();
+    const Int numTileCols = LBL.NumTileCols();
+    const Int ts = LBL.tileSize;
+    const Int m = LBL.height;
+    Matrix<F> Y, Z, M, W;
+    for( Int K=0; K<numTileCols; ++K )
+    {
+        auto dK = d( IR(K*ts,Min((K+1)*ts,n)), ALL );
+        for( Int J=0; J<numTileRows; ++J )
+        {
+            const Range<Int> indJ( J*ts, Min((J+1)*ts,m) );
+            const auto& UJ = LBL.U[J+K*numTileRows];
+            const auto& VJ = LBL.V[J+K*numTileRows];
+            const bool lowRankJ = LBL.LowRank(J,K);
+            if( lowRankJ && VJ.Height() == 0 )
+                continue;
+
+            // Y := D(K) op(V(J,K)), or D(K) op(L(J,K)) for a dense tile
+            Transpose( lowRankJ ? VJ : UJ, Y, conjugate );
+            DiagonalScale( LEFT, NORMAL, dK, Y );
+            for( Int I=J; I<numTileRows; ++I )
+            {
+                const Range<Int> indI( I*ts, Min((I+1)*ts,m) );
+                const auto& UI = LBL.U[I+K*numTileRows];
+                const auto& VI = LBL.V[I+K*numTileRows];
+
+                // M := L(I,K) Y
+                if( LBL.LowRank(I,K) )
+                {
+                    if( VI.Height() == 0 )
+                        continue;
+                    Gemm( NORMAL, NORMAL, F(1), VI, Y, Z );
+                    Gemm( NORMAL, NORMAL, F(1), UI, Z, M );
+                }
+                else
+                    Gemm( NORMAL, NORMAL, F(1), UI, Y, M );
+
+                auto ABRIJ = ABR( indI, indJ );
+                if( lowRankJ )
+                {
+                    if( I == J )
+                    {
+                        Gemm( NORMAL, orientation, F(1), M, UJ, W );
+                        AxpyTrapezoid( LOWER, F(-1), W, ABRIJ );
+                    }
+                    else
+                        Gemm( NORMAL, orientation, F(-1), M, UJ, F(1), ABRIJ );
+                }
+                else
+                {
+                    if( I == J )
+                        AxpyTrapezoid( LOWER, F(-1), M, ABRIJ );
+                    else
+                        ABRIJ -= M;
+                }
+            }
+        }
+    }
+}
+
+template<typename F>
+void ProcessFront
+( Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl )
 {
     DEBUG_CSE
     front.type = factorType;
@@ -159,6 +252,7 @@ void ProcessFront( Front<F>& front, LDLFrontType factorType )
       if( front.sparseLeaf )
           LogicError("This should not be possible");
     )
+    front.LBLR.Empty();
     const bool pivoted = PivotedFactorization( factorType );
     if( BlockFactorization(factorType) )
     {
@@ -178,6 +272,16 @@ void ProcessFront( Front<F>& front, LDLFrontType factorType )
           front.isHermitian );
         GetDiagonal( front.LDense, front.diag );
     }
+    else if( BLRFactorization(factorType) && front.workDense.Height() > 0 )
+    {
+        ProcessFrontBLR
+        ( front.LDense,
+          front.workDense,
+          front.LBLR,
+          front.isHermitian,
+          blrCtrl );
+        GetDiagonal( front.LDense, front.diag );
+    }
     else
     {
         ProcessFrontVanilla
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_SPLIT_HPP
+#define EL_LDL_SPLIT_HPP
+
+namespace El {
+namespace ldl {
+
+#ifdef EL_HYBRID
+
+// FrontType is either Front<F> or const Front<F>
+template<typename FrontType>
+struct Subtree
+{
+    const NodeInfo* info;
+    FrontType* front;
+    double work;
+};
+
+// The sum of frontWork over the fronts of the subtree
+template<typename FrontType,typename WorkFunc>
+inline double SubtreeWork
+( const NodeInfo& info, const FrontType& front, WorkFunc frontWork )
+{
+    double work = frontWork( info, front );
+    if( !front.sparseLeaf )
+    {
+        const int numChildren = info.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            work +=
+              SubtreeWork( *info.children[c], *front.children[c], frontWork );
+    }
+    return work;
+}
+
+// Split the tree into a set of independent subtrees which are to be traversed
+// concurrently by single threads and the fronts above them, which are to be
+// handled one at a time with every thread available to the dense kernels.
+//
+// Following Geist and Ng, the most expensive subtree is repeatedly replaced
+// by its children until it is cheap enough for the list to be balanced
+// over the threads. The subtrees are returned from most to least expensive
+// and the fronts above them in a (child before parent) postorder.
+template<typename FrontType,typename WorkFunc>
+inline void SplitTree
+( const NodeInfo& info,
+  FrontType& front,
+  int numThreads,
+  WorkFunc frontWork,
+  vector<Subtree<FrontType>>& subtrees,
+  vector<Subtree<FrontType>>& top )
+{
+    DEBUG_CSE
+    typedef Subtree<FrontType> SubtreeType;
+    auto lighter =
+      []( const SubtreeType& a, const SubtreeType& b )
+      { return a.work < b.work; };
+
+    subtrees.clear();
+    top.clear();
+    subtrees.push_back
+    ( SubtreeType{&info,&front,SubtreeWork(info,front,frontWork)} );
+    double subtreeWork = subtrees.back().work;
+    while( true )
+    {
+        auto heaviest =
+          std::max_element( subtrees.begin(), subtrees.end(), lighter );
+        const SubtreeType subtree = *heaviest;
+        if( subtree.front->sparseLeaf || subtree.info->children.empty() ||
+            subtree.work*numThreads <= subtreeWork )
+            break;
+
+        subtrees.erase( heaviest );
+        top.push_back( subtree );
+        subtreeWork -= subtree.work;
+        const int numChildren = subtree.info->children.size();
+        for( Int c=0; c<numChildren; ++c )
+        {
+            const NodeInfo& childInfo = *subtree.info->children[c];
+            FrontType& childFront = *subtree.front->children[c];
+            const double work = SubtreeWork( childInfo, childFront, frontWork );
+            subtrees.push_back( SubtreeType{&childInfo,&childFront,work} );
+            subtreeWork += work;
+        }
+    }
+
+    // Hand out the most expensive subtrees first
+    std::sort( subtrees.begin(), subtrees.end(),
+      [&]( const SubtreeType& a, const SubtreeType& b )
+      { return lighter( b, a ); } );
+
+    // Each front was split before any of its descendants, so reversing the
+    // order of the splits yields a valid (child before parent) ordering
+    std::reverse( top.begin(), top.end() );
+}
+
+// A rough count of the flops required to solve against a single front with
+// a single right-hand side. Unlike Front<F>::NumEntries, only the factor
+// entries of this particular front (and not of its descendants) are counted
+template<typename F>
+inline double SolveWork( const NodeInfo& info, const Front<F>& front )
+{
+    double numEntries = double(front.LDense.Height())*front.LDense.Width();
+    numEntries += front.LBLR.NumEntries();
+    if( front.sparseLeaf )
+        numEntries += front.LSparse.NumEntries();
+    return 2.*numEntries;
+}
+
+// Map each node of the elimination tree to the corresponding node of a tree
+// with the same structure (e.g., a MatrixNode)
+template<typename NodeType>
+inline void MapNodes
+( const NodeInfo& info,
+  NodeType& node,
+  std::map<const NodeInfo*,NodeType*>& nodes )
+{
+    nodes[&info] = &node;
+    const int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        MapNodes( *info.children[c], *node.children[c], nodes );
+}
+
+#endif // ifdef EL_HYBRID
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_SPLIT_HPP
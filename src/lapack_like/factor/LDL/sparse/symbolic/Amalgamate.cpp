@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <unordered_map>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// The number of entries in the lower trapezoid of a dense front
+inline double DenseEntries( double size, double updateSize )
+{ return size*(size+1)/2 + size*updateSize; }
+
+// Merge the (non-leaf) children of each front into it whenever the explicit
+// zeros of the merged front stay below the tolerance, working from the
+// leaves upward. The number of explicit zeros stored within each front is
+// tracked within 'zeros'.
+void AmalgamateRecursion
+( Separator& sep,
+  NodeInfo& node,
+  double tol,
+  std::unordered_map<const NodeInfo*,double>& zeros )
+{
+    DEBUG_CSE
+    const Int numChildren = node.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        AmalgamateRecursion( *sep.children[c], *node.children[c], tol, zeros );
+
+    // Merging a child cannot change the lower structure of the front since
+    // the child's structure is contained within the front
+    const double updateSize = node.lowerStruct.size();
+    double nodeZeros = 0;
+    vector<Separator*>
+      sepCandidates( sep.children.rbegin(), sep.children.rend() );
+    vector<NodeInfo*>
+      candidates( node.children.rbegin(), node.children.rend() );
+    sep.children.clear();
+    node.children.clear();
+    while( !candidates.empty() )
+    {
+        Separator* childSep = sepCandidates.back();
+        NodeInfo* child = candidates.back();
+        sepCandidates.pop_back();
+        candidates.pop_back();
+
+        // The leaves are factored as sparse matrices and are left alone
+        bool merge = false;
+        double mergedZeros = 0;
+        if( !child->children.empty() )
+        {
+            const double entries = DenseEntries( node.size, updateSize );
+            const double childEntries =
+              DenseEntries( child->size, child->lowerStruct.size() );
+            const double mergedEntries =
+              DenseEntries( node.size+child->size, updateSize );
+            mergedZeros = nodeZeros + zeros[child] +
+              (mergedEntries-entries-childEntries);
+            merge = ( mergedZeros <= tol*mergedEntries );
+        }
+        if( !merge )
+        {
+            sep.children.push_back( childSep );
+            node.children.push_back( child );
+            continue;
+        }
+
+        // Eliminate the indices of the child first and adopt its children
+        sep.inds.insert
+        ( sep.inds.begin(), childSep->inds.begin(), childSep->inds.end() );
+        node.size += child->size;
+        node.origLowerStruct =
+          Union( node.origLowerStruct, child->origLowerStruct );
+        nodeZeros = mergedZeros;
+        const Int numGrandchildren = child->children.size();
+        for( Int c=numGrandchildren-1; c>=0; --c )
+        {
+            childSep->children[c]->parent = &sep;
+            child->children[c]->parent = &node;
+            sepCandidates.push_back( childSep->children[c] );
+            candidates.push_back( child->children[c] );
+        }
+        childSep->children.clear();
+        child->children.clear();
+        zeros.erase( child );
+        delete childSep;
+        delete child;
+    }
+    zeros[&node] = nodeZeros;
+}
+
+} // anonymous namespace
+
+void Amalgamate( Separator& rootSep, NodeInfo& rootInfo, double tol )
+{
+    DEBUG_CSE
+    // The merges are decided from the lower structures of the fronts
+    Analysis( rootInfo );
+
+    // Record the original position of each index of the subtree, which
+    // occupies a contiguous range starting at the offset of its first leaf
+    std::unordered_map<Int,Int> origPositions;
+    function<void(const Separator&)> record =
+      [&]( const Separator& sep )
+      {
+          for( const Separator* child : sep.children )
+              record( *child );
+          const Int numInds = sep.inds.size();
+          for( Int t=0; t<numInds; ++t )
+              origPositions[sep.inds[t]] = sep.off + t;
+      };
+    record( rootSep );
+    const Separator* firstLeaf = &rootSep;
+    while( !firstLeaf->children.empty() )
+        firstLeaf = firstLeaf->children[0];
+    Int off = firstLeaf->off;
+
+    std::unordered_map<const NodeInfo*,double> zeros;
+    AmalgamateRecursion( rootSep, rootInfo, tol, zeros );
+
+    // Renumber the (merged) fronts in postorder
+    std::unordered_map<Int,Int> newPositions;
+    function<void(Separator&,NodeInfo&)> renumber =
+      [&]( Separator& sep, NodeInfo& node )
+      {
+          const Int numChildren = node.children.size();
+          for( Int c=0; c<numChildren; ++c )
+              renumber( *sep.children[c], *node.children[c] );
+          sep.off = off;
+          node.off = off;
+          for( Int t=0; t<node.size; ++t )
+              newPositions[origPositions[sep.inds[t]]] = off + t;
+          off += node.size;
+      };
+    renumber( rootSep, rootInfo );
+
+    // Translate the original structures into the new ordering, dropping the
+    // indices which now belong to the front itself
+    function<void(NodeInfo&)> translate =
+      [&]( NodeInfo& node )
+      {
+          for( NodeInfo* child : node.children )
+              translate( *child );
+          vector<Int> origLowerStruct;
+          for( const Int i : node.origLowerStruct )
+          {
+              auto it = newPositions.find( i );
+              const Int iNew = ( it == newPositions.end() ? i : it->second );
+              if( iNew >= node.off+node.size )
+                  origLowerStruct.push_back( iNew );
+          }
+          std::sort( origLowerStruct.begin(), origLowerStruct.end() );
+          node.origLowerStruct = origLowerStruct;
+      };
+    translate( rootInfo );
+}
+
+FrontStats GetFrontStats( const NodeInfo& rootInfo )
+{
+    DEBUG_CSE
+    FrontStats stats;
+    function<void(const NodeInfo&)> accumulate =
+      [&]( const NodeInfo& node )
+      {
+          for( const NodeInfo* child : node.children )
+              accumulate( *child );
+
+          const double n = node.size;
+          const double m = node.lowerStruct.size();
+          if( node.children.empty() && !node.LOffsets.empty() )
+          {
+              // Sparse leaves, mirroring Front<F>::FactorGFlops
+              const Int numSources = node.LOffsets.size()-1;
+              for( Int j=0; j<numSources; ++j )
+              {
+                  const double nnz = node.LOffsets[j+1]-node.LOffsets[j];
+                  stats.numFlops += nnz*(nnz+2.);
+              }
+              stats.numFlops += m*n + m*m*n;
+              stats.numEntries += node.LOffsets.back() + n + m*n;
+          }
+          else
+          {
+              stats.numFlops += n*n*n/3 + m*n*n + m*m*n;
+              stats.numEntries += DenseEntries( n, m );
+          }
+
+          Int bin = 0;
+          while( (Int(2) << bin) <= node.size )
+              ++bin;
+          if( Int(stats.sizeHistogram.size()) <= bin )
+              stats.sizeHistogram.resize( bin+1, 0 );
+          ++stats.sizeHistogram[bin];
+          ++stats.numFronts;
+      };
+    accumulate( rootInfo );
+    return stats;
+}
+
+void PrintFrontStats
+( const FrontStats& stats, const string& label, ostream& os )
+{
+    os << label << ":\n"
+       << "  fronts:  " << stats.numFronts << "\n"
+       << "  entries: " << stats.numEntries << "\n"
+       << "  flops:   " << stats.numFlops << "\n"
+       << "  sizes:\n";
+    const Int numBins = stats.sizeHistogram.size();
+    for( Int bin=0; bin<numBins; ++bin )
+        os << "    [" << (Int(1)<<bin) << "," << (Int(2)<<bin) << "): "
+           << stats.sizeHistogram[bin] << "\n";
+    os.flush();
+}
+
+} // namespace ldl
+} // namespace El
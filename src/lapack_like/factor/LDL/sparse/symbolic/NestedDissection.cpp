@@ -89,7 +89,14 @@ NestedDissectionRecursion
     const Int* offsetBuf = graph.LockedOffsetBuffer();
     const Int* sourceBuf = graph.LockedSourceBuffer();
     const Int* targetBuf = graph.LockedTargetBuffer();
-    if( numSources <= ctrl.cutoff )
+    // Without METIS there is no means of bisecting, so the entire subgraph
+    // is ordered with minimum degree
+#ifdef EL_HAVE_METIS
+    const bool haveMETIS = true;
+#else
+    const bool haveMETIS = false;
+#endif
+    if( numSources <= ctrl.cutoff || ctrl.minDegree || !haveMETIS )
     {
         // Filter out the graph of the diagonal block
         Int numValidEdges = 0;
@@ -371,6 +378,8 @@ NestedDissectionRecursion
 
         NestedDissectionRecursion
         ( seqGraph, perm.Map(), *sep.duplicate, *node.duplicate, off, ctrl );
+        if( ctrl.amalgamationTol > 0 )
+            Amalgamate( *sep.duplicate, *node.duplicate, ctrl.amalgamationTol );
 
         // Pull information up from the duplicates
         sep.off = sep.duplicate->off;
@@ -397,6 +406,8 @@ void NestedDissection
         perm[s] = s;
 
     NestedDissectionRecursion( graph, perm, sep, node, 0, ctrl );
+    if( ctrl.amalgamationTol > 0 )
+        Amalgamate( sep, node, ctrl.amalgamationTol );
 
     // Construct the distributed reordering    
     BuildMap( sep, map );
@@ -432,6 +443,51 @@ void NestedDissection
     Analysis( node, ctrl.storeFactRecvInds );
 }
 
+OrderingReport CompareOrderings( const Graph& graph, const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    OrderingReport report;
+
+    BisectCtrl ndCtrl( ctrl );
+    ndCtrl.minDegree = false;
+    {
+        vector<Int> map;
+        Separator sep;
+        NodeInfo node;
+        NestedDissection( graph, map, sep, node, ndCtrl );
+        report.nestedDissection = GetFrontStats( node );
+    }
+
+    BisectCtrl mdCtrl( ctrl );
+    mdCtrl.minDegree = true;
+    {
+        vector<Int> map;
+        Separator sep;
+        NodeInfo node;
+        NestedDissection( graph, map, sep, node, mdCtrl );
+        report.minDegree = GetFrontStats( node );
+    }
+
+    return report;
+}
+
+void PrintOrderingReport( const OrderingReport& report, ostream& os )
+{
+    PrintFrontStats( report.nestedDissection, "Nested dissection", os );
+    PrintFrontStats( report.minDegree, "Minimum degree", os );
+    const bool preferMinDegree =
+      report.minDegree.numFlops < report.nestedDissection.numFlops;
+    os << "Predicted fill ratio (minimum degree / nested dissection): "
+       << report.minDegree.numEntries / report.nestedDissection.numEntries
+       << "\n"
+       << "Predicted flop ratio (minimum degree / nested dissection): "
+       << report.minDegree.numFlops / report.nestedDissection.numFlops
+       << "\n"
+       << "Preferred ordering: "
+       << ( preferMinDegree ? "minimum degree" : "nested dissection" )
+       << endl;
+}
+
 void BuildMap( const Separator& rootSep, vector<Int>& map )
 {
     DEBUG_CSE
@@ -10,6 +10,7 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -141,6 +142,25 @@ void LU( Matrix<F>& A, Permutation& P )
     }
 }
 
+template<typename F>
+void LU( Matrix<F>& A, Permutation& P, LUPivotType pivotType )
+{
+    DEBUG_CSE
+    if( pivotType == LU_WITHOUT_PIVOTING )
+    {
+        P.MakeIdentity( A.Height() );
+        LU( A );
+    }
+    else if( pivotType == LU_PARTIAL || pivotType == LU_TOURNAMENT )
+    {
+        // The entire panel is local, so a tournament would have a single
+        // player and select the same pivots as partial pivoting
+        LU( A, P );
+    }
+    else
+        LogicError("Unsupported LU pivot type");
+}
+
 template<typename F>
 void LU
 ( Matrix<F>& A,
@@ -152,9 +172,28 @@ void LU
 }
 
 template<typename F>
-void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
+void LU( AbstractDistMatrix<F>& A, DistPermutation& P )
+{
+    DEBUG_CSE
+    LU( A, P, LU_PARTIAL );
+}
+
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& APre,
+  DistPermutation& P,
+  LUPivotType pivotType )
 {
     DEBUG_CSE
+    if( pivotType == LU_WITHOUT_PIVOTING )
+    {
+        P.SetGrid( APre.Grid() );
+        P.MakeIdentity( APre.Height() );
+        LU( APre );
+        return;
+    }
+    if( pivotType != LU_PARTIAL && pivotType != LU_TOURNAMENT )
+        LogicError("Unsupported LU pivot type");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -199,7 +238,10 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        if( pivotType == LU_TOURNAMENT )
+            lu::TournamentPanel( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
 
         PB.PermuteRows( AB );
 
@@ -230,6 +272,33 @@ void LU
     lu::Full( A, P, Q );
 }
 
+template<typename F>
+Base<F> lu::GrowthFactor( const Matrix<F>& A, const Matrix<F>& LU )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real maxA = MaxNorm( A );
+    if( maxA == Real(0) )
+        return Real(0);
+    auto U( LU );
+    MakeTrapezoidal( UPPER, U );
+    return MaxNorm( U ) / maxA;
+}
+
+template<typename F>
+Base<F> lu::GrowthFactor
+( const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& LU )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real maxA = MaxNorm( A );
+    if( maxA == Real(0) )
+        return Real(0);
+    DistMatrix<F> U( LU );
+    MakeTrapezoidal( UPPER, U );
+    return MaxNorm( U ) / maxA;
+}
+
 #define PROTO(F) \
   template void LU( Matrix<F>& A ); \
   template void LU( AbstractDistMatrix<F>& A ); \
@@ -241,6 +310,14 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( Matrix<F>& A, \
+    Permutation& P, \
+    LUPivotType pivotType ); \
+  template void LU \
+  ( AbstractDistMatrix<F>& A, \
+    DistPermutation& P, \
+    LUPivotType pivotType ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -274,6 +351,16 @@ void LU
     DistPermutation& PB, \
     Int offset, \
     vector<F>& pivotBuf ); \
+  template void lu::TournamentPanel \
+  ( DistMatrix<F,  STAR,STAR>& A11, \
+    DistMatrix<F,  MC,  STAR>& A21, \
+    DistPermutation& P, \
+    DistPermutation& PB, \
+    Int offset ); \
+  template Base<F> lu::GrowthFactor \
+  ( const Matrix<F>& A, const Matrix<F>& LU ); \
+  template Base<F> lu::GrowthFactor \
+  ( const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& LU ); \
   template void lu::SolveAfter \
   ( Orientation orientation, \
     const Matrix<F>& A, \
@@ -0,0 +1,251 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+// Select Min(m,n) of the m x n candidate rows in C as pivots via partial
+// pivoting and overwrite C and inds with the selected rows (in their original,
+// unfactored form) and their indices.
+//
+// Since the candidates are only a subset of the rows of the panel, a column
+// without a nonzero pivot candidate is skipped rather than treated as
+// evidence of singularity.
+template<typename F>
+void TournamentSelect( Matrix<F>& C, vector<Int>& inds )
+{
+    DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int numSelect = Min(m,n);
+
+    Matrix<F> CFact( C );
+    F* CBuf = CFact.Buffer();
+    const Int CLDim = CFact.LDim();
+    vector<Int> perm( m );
+    for( Int i=0; i<m; ++i )
+        perm[i] = i;
+    for( Int k=0; k<numSelect; ++k )
+    {
+        const Int ind2HorzSize = n - (k+1);
+        const Int ind2VertSize = m - (k+1);
+        const F* a12Buf = &CBuf[ k    + (k+1)*CLDim];
+              F* a21Buf = &CBuf[(k+1) +  k   *CLDim];
+              F* A22Buf = &CBuf[(k+1) + (k+1)*CLDim];
+
+        const Int iPiv =
+          k + blas::MaxInd( ind2VertSize+1, &CBuf[k+k*CLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &CBuf[k], CLDim, &CBuf[iPiv], CLDim );
+            std::swap( perm[k], perm[iPiv] );
+        }
+
+        const F alpha = CBuf[k+k*CLDim];
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( ind2VertSize, F(1)/alpha, a21Buf, 1 );
+        blas::Geru
+        ( ind2VertSize, ind2HorzSize,
+          F(-1), a21Buf, 1, a12Buf, CLDim, A22Buf, CLDim );
+    }
+
+    Matrix<F> CSelect( numSelect, n );
+    vector<Int> indsSelect( numSelect );
+    for( Int i=0; i<numSelect; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+            CSelect(i,j) = C(perm[i],j);
+        indsSelect[i] = inds[perm[i]];
+    }
+    C = CSelect;
+    inds = indsSelect;
+}
+
+// Communication-avoiding LU panel factorization with tournament pivoting
+// (CALU).
+//
+// Rather than performing a reduction over the process column for each of the
+// n columns of the panel, each process selects n candidate pivot rows from
+// its portion of the panel with partial pivoting and the candidates are then
+// played against each other, two sets at a time, in a binary reduction tree
+// until n pivot rows remain. Each of the log2(p) levels of the tree sends at
+// most n x n candidate entries between a pair of processes, and the winners
+// are then broadcast over the process column and swapped to the top of the
+// panel, which is factored without any further pivoting.
+//
+// NOTE: The interface mirrors that of Panel, though A and B need not share a
+//       buffer and every process must have the correct data for A on entry.
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = mpi::Rank( colComm );
+    const int colSize = mpi::Size( colComm );
+    DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Height() != n )
+          LogicError("A must be square");
+    )
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // Select the local candidates, with the (redundantly stored) rows of A
+    // only entered by the first process of the column
+    const Int ALocHeight = ( colRank == 0 ? n : 0 );
+    Matrix<F> C( ALocHeight+BLocHeight, n );
+    vector<Int> inds( ALocHeight+BLocHeight );
+    if( colRank == 0 )
+    {
+        auto CT = C( IR(0,n), ALL );
+        CT = A.LockedMatrix();
+        for( Int i=0; i<n; ++i )
+            inds[i] = i;
+    }
+    auto CB = C( IR(ALocHeight,END), ALL );
+    CB = B.LockedMatrix();
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+        inds[ALocHeight+iLoc] = B.GlobalRow(iLoc) + n;
+    TournamentSelect( C, inds );
+
+    // Play the matches of a binary reduction tree over the process column.
+    // At each level, the process whose rank is an odd multiple of the stride
+    // sends its candidates to its partner and drops out of the tournament.
+    // Each message carries the (at most n) candidate indices followed by the
+    // n x n candidate rows.
+    vector<Int> candidateInds( n, -1 );
+    vector<F> candidateVals( n*n );
+    for( Int stride=1; stride<colSize; stride*=2 )
+    {
+        if( colRank % (2*stride) == stride )
+        {
+            const Int numCandidates = C.Height();
+            for( Int i=0; i<numCandidates; ++i )
+            {
+                for( Int j=0; j<n; ++j )
+                    candidateVals[i*n+j] = C(i,j);
+                candidateInds[i] = inds[i];
+            }
+            for( Int i=numCandidates; i<n; ++i )
+                candidateInds[i] = -1;
+            const int partner = colRank - stride;
+            mpi::Send( candidateInds.data(), n, partner, colComm );
+            mpi::Send
+            ( candidateVals.data(), numCandidates*n, partner, colComm );
+            break;
+        }
+        if( colRank % (2*stride) == 0 && colRank+stride < colSize )
+        {
+            const int partner = colRank + stride;
+            mpi::Recv( candidateInds.data(), n, partner, colComm );
+            Int numChallengers = 0;
+            while( numChallengers < n && candidateInds[numChallengers] >= 0 )
+                ++numChallengers;
+            mpi::Recv
+            ( candidateVals.data(), numChallengers*n, partner, colComm );
+
+            const Int numWinners = C.Height();
+            Matrix<F> D( numWinners+numChallengers, n );
+            auto DT = D( IR(0,numWinners), ALL );
+            DT = C;
+            for( Int i=0; i<numChallengers; ++i )
+            {
+                for( Int j=0; j<n; ++j )
+                    D(numWinners+i,j) = candidateVals[i*n+j];
+                inds.push_back( candidateInds[i] );
+            }
+            TournamentSelect( D, inds );
+            C = D;
+        }
+    }
+
+    // Broadcast the winners from the root of the tree
+    if( colRank == 0 )
+    {
+        DEBUG_ONLY(
+          if( C.Height() != n )
+              LogicError("Tournament did not produce a full set of pivots");
+        )
+        for( Int i=0; i<n; ++i )
+        {
+            for( Int j=0; j<n; ++j )
+                candidateVals[i*n+j] = C(i,j);
+            candidateInds[i] = inds[i];
+        }
+    }
+    mpi::Broadcast( candidateInds.data(), n, 0, colComm );
+    mpi::Broadcast( candidateVals.data(), n*n, 0, colComm );
+    Matrix<F> pivotRows( n, n );
+    for( Int i=0; i<n; ++i )
+        for( Int j=0; j<n; ++j )
+            pivotRows(i,j) = candidateVals[i*n+j];
+    const auto& pivotInds = candidateInds;
+
+    // Convert the pivot rows into a sequence of swaps. Only the winners move
+    // up from B, and so they never move before being selected, while the
+    // rows they displace are always (not yet selected) original rows of A.
+    Matrix<F> AOrig( A.LockedMatrix() );
+    vector<Int> rowAt( n ), posOf( n );
+    for( Int i=0; i<n; ++i )
+        rowAt[i] = posOf[i] = i;
+    std::map<Int,Int> displacedRows;
+    for( Int k=0; k<n; ++k )
+    {
+        const Int iWin = pivotInds[k];
+        const Int iPiv = ( iWin < n ? posOf[iWin] : iWin );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+
+        const Int iDisplaced = rowAt[k];
+        rowAt[k] = iWin;
+        if( iWin < n )
+            posOf[iWin] = k;
+        posOf[iDisplaced] = iPiv;
+        if( iPiv < n )
+            rowAt[iPiv] = iDisplaced;
+        else
+            displacedRows[iPiv] = iDisplaced;
+    }
+
+    // Every process knows both the winners and the displaced rows, so the
+    // swaps can be applied to the panel without any further communication
+    A.Matrix() = pivotRows;
+    for( const auto& entry : displacedRows )
+    {
+        const Int i = entry.first - n;
+        if( B.IsLocalRow(i) )
+        {
+            const Int iLoc = B.LocalRow(i);
+            for( Int j=0; j<n; ++j )
+                B.SetLocal( iLoc, j, AOrig(entry.second,j) );
+        }
+    }
+
+    // Factor the panel without pivoting
+    Unb( A.Matrix() );
+    LocalTrsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A, B );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
@@ -12,6 +12,7 @@
 #include "./QR/BusingerGolub.hpp"
 #include "./QR/Cholesky.hpp"
 #include "./QR/Householder.hpp"
+#include "./QR/Randomized.hpp"
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
 
@@ -75,6 +76,19 @@ void QR
     qr::Householder( A, householderScalars, signature );
 }
 
+template<typename F>
+void QR
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.colPiv )
+        LogicError("Column pivoting requires a permutation");
+    qr::Householder( A, householderScalars, signature, ctrl );
+}
+
 // Variants which perform (Businger-Golub) column-pivoting
 // =======================================================
 
@@ -87,7 +101,10 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+    if( ctrl.randomized )
+        qr::Randomized( A, householderScalars, signature, Omega, ctrl );
+    else
+        qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
 }
 
 template<typename F>
@@ -99,7 +116,10 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+    if( ctrl.randomized )
+        qr::Randomized( A, householderScalars, signature, Omega, ctrl );
+    else
+        qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
 }
 
 #define PROTO(F) \
@@ -112,6 +132,11 @@ void QR
     AbstractDistMatrix<F>& householderScalars, \
     AbstractDistMatrix<Base<F>>& signature ); \
   template void QR \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature, \
+    const QRCtrl<Base<F>>& ctrl ); \
+  template void QR \
   ( Matrix<F>& A, \
     Matrix<F>& householderScalars, \
     Matrix<Base<F>>& signature, \
@@ -195,10 +220,12 @@ void QR
   template void qr::Cholesky \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& R ); \
-  template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
+  template qr::TreeData<F> qr::TS \
+  ( const AbstractDistMatrix<F>& A, const TSQRCtrl& ctrl ); \
   template void qr::ExplicitTS \
   ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R ); \
+    AbstractDistMatrix<F>& R, \
+    const TSQRCtrl& ctrl ); \
   template Matrix<F>& qr::ts::RootQR \
   ( const AbstractDistMatrix<F>& A, TreeData<F>& treeData ); \
   template const Matrix<F>& qr::ts::RootQR \
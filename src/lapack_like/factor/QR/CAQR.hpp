@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_CAQR_HPP
+#define EL_QR_CAQR_HPP
+
+#include "./TS.hpp"
+
+namespace El {
+namespace qr {
+
+// A drop-in replacement for the distributed PanelHouseholder which computes
+// an explicit TSQR factorization of the panel, A = Q R, and then reconstructs
+// the Householder vectors of A from Q following Ballard et al.'s
+// "Reconstructing Householder vectors from tall-skinny QR".
+//
+// An LU factorization (without pivoting) of Q - [S; 0] = Y U, where the
+// diagonal matrix S of signs is chosen during the factorization so that
+// |U(j,j)| >= 1, yields the unit lower-trapezoidal Householder vectors Y and
+// the block reflector I - Y T Y^H, with T = -U S Y1^{-H}, which maps [S R; 0]
+// to A. Only the diagonal of T is needed for the Householder scalars.
+template<typename F>
+void CAQRPanel
+( DistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature,
+  const TSQRCtrl& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( A, householderScalars, signature ))
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+        LogicError("CAQR panels must be tall");
+
+    // Form the explicit TSQR factorization over the entire grid
+    DistMatrix<F,VC,STAR> Q( A );
+    auto treeData = TS( Q, ctrl );
+    auto R = ts::FormR( Q, treeData );
+    ts::FormQ( Q, treeData );
+
+    // Q - [S; 0] = Y U
+    auto QT = Q( IR(0,n), ALL );
+    auto QB = Q( IR(n,END), ALL );
+    DistMatrix<F,STAR,STAR> YT( QT );
+    Matrix<Real> s( n, 1 );
+    {
+        auto& YTLoc = YT.Matrix();
+        F* YBuf = YTLoc.Buffer();
+        const Int YLDim = YTLoc.LDim();
+        for( Int j=0; j<n; ++j )
+        {
+            const F upsilon = YBuf[j+j*YLDim];
+            s(j) = ( RealPart(upsilon) >= Real(0) ? Real(-1) : Real(1) );
+            YBuf[j+j*YLDim] = upsilon - s(j);
+            const F upsilonInv = F(1) / YBuf[j+j*YLDim];
+            blas::Scal( n-(j+1), upsilonInv, &YBuf[(j+1)+j*YLDim], 1 );
+            blas::Geru
+            ( n-(j+1), n-(j+1),
+              F(-1), &YBuf[(j+1)+j*YLDim], 1, &YBuf[j+(j+1)*YLDim], YLDim,
+                     &YBuf[(j+1)+(j+1)*YLDim], YLDim );
+        }
+    }
+    LocalTrsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), YT, QB );
+
+    // The reflectors are applied as I - conj(tau_j) y_j y_j^H, so each
+    // Householder scalar is the conjugate of the corresponding entry of
+    // diag(T) = -diag(U) S
+    for( Int j=0; j<n; ++j )
+        householderScalars.Set( j, 0, -Conj(YT.GetLocal(j,j))*s(j) );
+
+    // A = (I - Y T Y^H) [S R; 0], so the triangular factor is S R, which is
+    // then normalized in the same manner as PanelHouseholder
+    DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, s, R.Matrix() );
+    Matrix<Real> sig;
+    GetRealPartOfDiagonal( R.Matrix(), sig );
+    auto sgn = []( const Real& delta )
+               { return delta >= Real(0) ? Real(1) : Real(-1); };
+    EntrywiseMap( sig, function<Real(Real)>(sgn) );
+    DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, sig, R.Matrix() );
+    for( Int j=0; j<n; ++j )
+        signature.Set( j, 0, sig(j) );
+
+    // Pack the Householder vectors below the triangular factor
+    MakeTrapezoidal( LOWER, YT, -1 );
+    Axpy( F(1), R, YT );
+    QT = YT;
+    A = Q;
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_CAQR_HPP
@@ -47,7 +47,7 @@ void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
     Zeros( R, n, n );
     Herk( UPPER, ADJOINT, Base<F>(1), A.Matrix(), Base<F>(0), R.Matrix() );
     El::AllReduce( R, A.ColComm() );
-    El::Cholesky( UPPER, R.Matrix() );
+    El::Cholesky( UPPER, R );
     Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
 }
 
@@ -21,7 +21,7 @@ void ExplicitTriang( Matrix<F>& A, const QRCtrl<Base<F>>& ctrl )
     if( ctrl.colPiv )
     {
         Permutation Omega;
-        BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+        QR( A, householderScalars, signature, Omega, ctrl );
     }
     else
         Householder( A, householderScalars, signature );
@@ -39,7 +39,7 @@ void ExplicitTriang( AbstractDistMatrix<F>& A, const QRCtrl<Base<F>>& ctrl )
     if( ctrl.colPiv )
     {
         DistPermutation Omega(A.Grid());
-        BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+        QR( A, householderScalars, signature, Omega, ctrl );
     }
     else
         Householder( A, householderScalars, signature );
@@ -11,6 +11,7 @@
 
 #include "./ApplyQ.hpp"
 #include "./PanelHouseholder.hpp"
+#include "./CAQR.hpp"
 
 namespace El {
 namespace qr {
@@ -53,7 +54,8 @@ void
 Householder
 ( AbstractDistMatrix<F>& APre,
   AbstractDistMatrix<F>& householderScalarsPre,
-  AbstractDistMatrix<Base<F>>& signaturePre )
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  const QRCtrl<Base<F>>& ctrl=QRCtrl<Base<F>>() )
 {
     DEBUG_CSE
     DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
@@ -86,7 +88,10 @@ Householder
         auto householderScalars1 = householderScalars( ind1, ALL );
         auto sig1 = signature( ind1, ALL );
 
-        PanelHouseholder( AB1, householderScalars1, sig1 );
+        if( ctrl.caqr )
+            CAQRPanel( AB1, householderScalars1, sig1, ctrl.tsqrCtrl );
+        else
+            PanelHouseholder( AB1, householderScalars1, sig1 );
         ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
     }
 }
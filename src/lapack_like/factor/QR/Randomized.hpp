@@ -0,0 +1,314 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_RANDOMIZED_HPP
+#define EL_QR_RANDOMIZED_HPP
+
+#include "./BusingerGolub.hpp"
+#include "./Householder.hpp"
+
+namespace El {
+namespace qr {
+
+// Randomized column-pivoted QR in the spirit of Martinsson et al.'s HQRRP and
+// Duersch and Gu's "Randomized QR with column pivoting".
+//
+// Rather than downdating (and, in parallel, all-reducing) the column norms
+// after every Householder reflection, the pivots for each block of columns
+// are chosen by running Businger-Golub on a small Gaussian sketch, B = G A,
+// of the trailing matrix. The selected columns are then factored with an
+// unpivoted Householder QR and the trailing matrix is updated with level-3
+// operations. Since B P = (G Q) R, the sketch of the next trailing matrix can
+// be cheaply downdated as
+//
+//   B2 := B2 - B1 inv(R11) R12,
+//
+// though the sketch is regenerated if R11 is numerically singular.
+
+template<typename F>
+void Randomized
+(       Matrix<F>& A,
+        Matrix<F>& householderScalars,
+        Matrix<Base<F>>& signature,
+        Permutation& Omega,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.smallestFirst )
+        LogicError("Randomized pivoting does not support smallestFirst");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int maxSteps = ( ctrl.boundRank ? Min(ctrl.maxRank,minDim) : minDim );
+    const Int bsize = Blocksize();
+    const Int sketchHeight = Min(bsize+ctrl.oversample,m);
+    householderScalars.Resize( maxSteps, 1 );
+    signature.Resize( maxSteps, 1 );
+
+    vector<Real> norms;
+    const Real maxOrigNorm = ColNorms( A, norms );
+    const Real singularTol = limits::Epsilon<Real>()*maxOrigNorm;
+
+    Omega.MakeIdentity( n );
+    Omega.ReserveSwaps( n );
+
+    Matrix<F> G, B;
+    Gaussian( G, sketchHeight, m );
+    Gemm( NORMAL, NORMAL, F(1), G, A, B );
+
+    QRCtrl<Real> sketchCtrl;
+    sketchCtrl.boundRank = true;
+    Matrix<F> BSketch, householderScalarsB, AB1Copy;
+    Matrix<Real> signatureB;
+    Permutation OmegaB;
+
+    Int k=0;
+    while( k < maxSteps )
+    {
+        const Int nb = Min(bsize,maxSteps-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+        auto AR = A( ALL, indB );
+        auto BR = B( ALL, indB );
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto R11 = A( ind1, ind1 );
+        auto R12 = A( ind1, ind2 );
+        auto B1 = B( ALL, ind1 );
+        auto B2 = B( ALL, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto signature1 = signature( ind1, ALL );
+
+        // Choose the pivots of this block from the sketch
+        BSketch = BR;
+        sketchCtrl.maxRank = nb;
+        BusingerGolub
+        ( BSketch, householderScalarsB, signatureB, OmegaB, sketchCtrl );
+        OmegaB.PermuteCols( AR );
+        OmegaB.PermuteCols( BR );
+        Omega.SwapSequence( OmegaB, k );
+
+        // Factor the selected columns (keeping a copy in case some of them
+        // are rejected by the adaptive stopping criterion)
+        if( ctrl.adaptive )
+            AB1Copy = AB1;
+        Householder( AB1, householderScalars1, signature1 );
+
+        // Mirror the adaptive stopping criterion of Businger-Golub, where the
+        // norm of each pivot column is the magnitude of the diagonal of R
+        Int numAccepted = nb;
+        bool singular = false;
+        for( Int j=0; j<nb; ++j )
+        {
+            const Real rho = Abs(R11(j,j));
+            if( ctrl.adaptive && rho <= ctrl.tol*maxOrigNorm )
+            {
+                numAccepted = j;
+                break;
+            }
+            if( rho <= singularTol )
+                singular = true;
+        }
+        if( numAccepted < nb )
+        {
+            // Restore the rejected columns and only apply the accepted
+            // reflectors to the remainder of the matrix
+            const Range<Int> indAcc( 0, numAccepted ),
+                             indRej( numAccepted, nb );
+            auto AB1Rej = AB1( ALL, indRej );
+            AB1Rej = AB1Copy( ALL, indRej );
+            auto ABRej = A( indB, IR(k+numAccepted,END) );
+            ApplyQ
+            ( LEFT, ADJOINT,
+              AB1( ALL, indAcc ),
+              householderScalars1( indAcc, ALL ),
+              signature1( indAcc, ALL ), ABRej );
+            k += numAccepted;
+            break;
+        }
+
+        // Update the trailing matrix
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, signature1, AB2 );
+        k += nb;
+        if( k == maxSteps )
+            break;
+
+        // Update the sketch of the trailing matrix
+        if( singular )
+        {
+            Gaussian( G, sketchHeight, m-k );
+            Gemm( NORMAL, NORMAL, F(1), G, A(ind2,ind2), F(0), B2 );
+        }
+        else
+        {
+            Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R11, B1 );
+            Gemm( NORMAL, NORMAL, F(-1), B1, R12, F(1), B2 );
+        }
+    }
+    householderScalars.Resize( k, 1 );
+    signature.Resize( k, 1 );
+}
+
+template<typename F>
+void Randomized
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  DistPermutation& Omega,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    typedef Base<F> Real;
+    if( ctrl.smallestFirst )
+        LogicError("Randomized pivoting does not support smallestFirst");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+    const Grid& g = A.Grid();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int maxSteps = ( ctrl.boundRank ? Min(ctrl.maxRank,minDim) : minDim );
+    const Int bsize = Blocksize();
+    const Int sketchHeight = Min(bsize+ctrl.oversample,m);
+    householderScalars.Resize( maxSteps, 1 );
+    signature.Resize( maxSteps, 1 );
+
+    vector<Real> norms( A.LocalWidth() );
+    const Real maxOrigNorm = ColNorms( A, norms );
+    const Real singularTol = limits::Epsilon<Real>()*maxOrigNorm;
+
+    Omega.MakeIdentity( n );
+    Omega.ReserveSwaps( n );
+
+    // The sketch is small enough to be redundantly stored (and pivoted) on
+    // every process, so that choosing the pivots requires no communication
+    DistMatrix<F> G(g), BDist(g), AB1Copy(g);
+    Gaussian( G, sketchHeight, m );
+    Gemm( NORMAL, NORMAL, F(1), G, A, BDist );
+    DistMatrix<F,STAR,STAR> B_STAR_STAR( BDist );
+    auto& B = B_STAR_STAR.Matrix();
+
+    QRCtrl<Real> sketchCtrl;
+    sketchCtrl.boundRank = true;
+    Matrix<F> BSketch, householderScalarsB;
+    Matrix<Real> signatureB;
+    Permutation OmegaB;
+    DistPermutation OmegaBDist(g);
+    DistMatrix<F,STAR,STAR> R11_STAR_STAR(g), R12_STAR_STAR(g), B2New(g);
+
+    Int k=0;
+    while( k < maxSteps )
+    {
+        const Int nb = Min(bsize,maxSteps-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+        auto AR = A( ALL, indB );
+        auto BR = B( ALL, indB );
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto B1 = B( ALL, ind1 );
+        auto B2 = B( ALL, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto signature1 = signature( ind1, ALL );
+
+        // Choose the pivots of this block from the sketch
+        BSketch = BR;
+        sketchCtrl.maxRank = nb;
+        BusingerGolub
+        ( BSketch, householderScalarsB, signatureB, OmegaB, sketchCtrl );
+        OmegaB.PermuteCols( BR );
+        const auto swapDests = OmegaB.SwapDestinations();
+        OmegaBDist.MakeIdentity( n-k );
+        OmegaBDist.ReserveSwaps( nb );
+        for( Int j=0; j<swapDests.Height(); ++j )
+        {
+            OmegaBDist.Swap( j, swapDests(j) );
+            Omega.Swap( k+j, k+swapDests(j) );
+        }
+        OmegaBDist.PermuteCols( AR );
+
+        // Factor the selected columns (keeping a copy in case some of them
+        // are rejected by the adaptive stopping criterion)
+        if( ctrl.adaptive )
+            AB1Copy = AB1;
+        Householder( AB1, householderScalars1, signature1 );
+
+        // Mirror the adaptive stopping criterion of Businger-Golub
+        R11_STAR_STAR = A( ind1, ind1 );
+        const auto& R11 = R11_STAR_STAR.LockedMatrix();
+        Int numAccepted = nb;
+        bool singular = false;
+        for( Int j=0; j<nb; ++j )
+        {
+            const Real rho = Abs(R11(j,j));
+            if( ctrl.adaptive && rho <= ctrl.tol*maxOrigNorm )
+            {
+                numAccepted = j;
+                break;
+            }
+            if( rho <= singularTol )
+                singular = true;
+        }
+        if( numAccepted < nb )
+        {
+            // Restore the rejected columns and only apply the accepted
+            // reflectors to the remainder of the matrix
+            const Range<Int> indAcc( 0, numAccepted ),
+                             indRej( numAccepted, nb );
+            auto AB1Rej = AB1( ALL, indRej );
+            AB1Rej = AB1Copy( ALL, indRej );
+            auto ABRej = A( indB, IR(k+numAccepted,END) );
+            ApplyQ
+            ( LEFT, ADJOINT,
+              AB1( ALL, indAcc ),
+              householderScalars1( indAcc, ALL ),
+              signature1( indAcc, ALL ), ABRej );
+            k += numAccepted;
+            break;
+        }
+
+        // Update the trailing matrix
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, signature1, AB2 );
+        k += nb;
+        if( k == maxSteps )
+            break;
+
+        // Update the sketch of the trailing matrix
+        if( singular )
+        {
+            Gaussian( G, sketchHeight, m-k );
+            Gemm( NORMAL, NORMAL, F(1), G, A(ind2,ind2), BDist );
+            B2New = BDist;
+            B2 = B2New.LockedMatrix();
+        }
+        else
+        {
+            R12_STAR_STAR = A( ind1, ind2 );
+            Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R11, B1 );
+            Gemm
+            ( NORMAL, NORMAL, F(-1), B1, R12_STAR_STAR.LockedMatrix(),
+              F(1), B2 );
+        }
+    }
+    householderScalars.Resize( k, 1 );
+    signature.Resize( k, 1 );
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_RANDOMIZED_HPP
@@ -13,6 +13,89 @@ namespace El {
 namespace qr {
 namespace ts {
 
+// The neighbors of a process within the reduction tree: the process which it
+// sends its triangular factor to (-1 for the root) and the processes whose
+// triangular factors it merges into its own, in the order of the merges.
+//
+// The processes are split into groups of consecutive ranks which are each
+// reduced onto their first process with a flat tree before the group leaders
+// are reduced with a binary (binomial) tree. The binary and flat trees
+// respectively correspond to groups of a single process and of every process.
+inline void TreeNeighbors
+( Int rank, Int numProcs, const TSQRCtrl& ctrl,
+  Int& parent, vector<Int>& children )
+{
+    DEBUG_CSE
+    Int groupSize;
+    if( ctrl.tree == TSQR_BINARY_TREE )
+        groupSize = 1;
+    else if( ctrl.tree == TSQR_FLAT_TREE )
+        groupSize = numProcs;
+    else
+    {
+        if( ctrl.groupSize < 1 )
+            LogicError("Invalid TSQR group size of ",ctrl.groupSize);
+        groupSize = ctrl.groupSize;
+    }
+    const Int group = rank / groupSize;
+    const Int leader = group*groupSize;
+    const Int numGroups = (numProcs+groupSize-1) / groupSize;
+
+    parent = -1;
+    children.clear();
+    if( rank != leader )
+    {
+        parent = leader;
+        return;
+    }
+    for( Int q=leader+1; q<Min(leader+groupSize,numProcs); ++q )
+        children.push_back( q );
+    for( Int stride=1; stride<numGroups; stride*=2 )
+    {
+        if( group & stride )
+        {
+            parent = (group-stride)*groupSize;
+            return;
+        }
+        if( group+stride < numGroups )
+            children.push_back( (group+stride)*groupSize );
+    }
+}
+
+// The height of the triangular factor which the given process sends to its
+// parent, i.e., the number of rows in its subtree (but at most n)
+inline Int SubtreeHeight
+( Int rank, Int numProcs, Int m, Int n, Int colAlign, const TSQRCtrl& ctrl )
+{
+    DEBUG_CSE
+    Int parent;
+    vector<Int> children;
+    TreeNeighbors( rank, numProcs, ctrl, parent, children );
+    Int height = Min( Length(m,rank,colAlign,numProcs), n );
+    for( const Int child : children )
+        height =
+          Min( height+SubtreeHeight(child,numProcs,m,n,colAlign,ctrl), n );
+    return height;
+}
+
+template<typename F>
+void SendRows( const Matrix<F>& Z, Int to, mpi::Comm comm )
+{
+    DEBUG_CSE
+    Matrix<F> ZContig;
+    ZContig.Resize( Z.Height(), Z.Width(), Max(Z.Height(),1) );
+    ZContig = Z;
+    mpi::Send( ZContig.LockedBuffer(), Z.Height()*Z.Width(), to, comm );
+}
+
+template<typename F>
+void RecvRows( Matrix<F>& Z, Int height, Int width, Int from, mpi::Comm comm )
+{
+    DEBUG_CSE
+    Z.Resize( height, width, Max(height,1) );
+    mpi::Recv( Z.Buffer(), height*width, from, comm );
+}
+
 template<typename F>
 void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 {
@@ -28,61 +111,54 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     if( p == 1 )
         return;
     const Int rank = mpi::Rank( colComm );
-    if( m < p*n )
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
+    if( m < n )
+        LogicError("TSQR currently assumes height >= width");
+
+    Int parent;
+    vector<Int> children;
+    TreeNeighbors( rank, p, treeData.ctrl, parent, children );
+    const Int numChildren = children.size();
 
+    Int height = Min( A.LocalHeight(), n );
     Matrix<F> lastZ;
-    lastZ = treeData.QR0( IR(0,n), IR(0,n) );
+    lastZ = treeData.QR0( IR(0,height), ALL );
+    MakeTrapezoidal( UPPER, lastZ );
 
-    treeData.QRList.resize( logp );
-    treeData.householderScalarsList.resize( logp );
-    treeData.signatureList.resize( logp );
+    treeData.QRList.resize( numChildren );
+    treeData.householderScalarsList.resize( numChildren );
+    treeData.signatureList.resize( numChildren );
 
-    // Run the binary tree reduction
-    Matrix<F> ZTop(n,n,n), ZBot(n,n,n);
-    for( Int stage=0; stage<logp; ++stage )
+    // Merge the triangular factors of the children in turn
+    Matrix<F> ZBot;
+    for( Int c=0; c<numChildren; ++c )
     {
-        // Pack, then send and receive n x n matrices
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
-        {
-            ZTop = lastZ;
-            MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
-        }
-        else
-        {
-            ZBot = lastZ;
-            MakeTrapezoidal( UPPER, ZBot );
-            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
-            break;
-        }
+        const Int childHeight =
+          SubtreeHeight( children[c], p, m, n, A.ColAlign(), treeData.ctrl );
+        RecvRows( ZBot, childHeight, n, children[c], colComm );
 
-        auto& QRFact = treeData.QRList[stage];
-        auto& householderScalars = treeData.householderScalarsList[stage];
-        auto& signature = treeData.signatureList[stage];
-        QRFact.Resize( 2*n, n, 2*n );
-        householderScalars.Resize( n, 1 );
-        signature.Resize( n, 1 );
-        auto QRFactTop = QRFact( IR(0,n),   IR(0,n) );
-        auto QRFactBot = QRFact( IR(n,2*n), IR(0,n) );
-        QRFactTop = ZTop;
+        auto& QRFact = treeData.QRList[c];
+        auto& householderScalars = treeData.householderScalarsList[c];
+        auto& signature = treeData.signatureList[c];
+        QRFact.Resize( height+childHeight, n );
+        auto QRFactTop = QRFact( IR(0,height),   ALL );
+        auto QRFactBot = QRFact( IR(height,END), ALL );
+        QRFactTop = lastZ;
         QRFactBot = ZBot;
+        height = Min( height+childHeight, n );
 
         // Note that the last QR is not performed by this routine, as many
         // higher-level routines, such as TS-SVT, are simplified if the final
         // small matrix is left alone.
-        if( stage < logp-1 )
+        if( parent != -1 || c < numChildren-1 )
         {
             // TODO: Exploit double-triangular structure
             QR( QRFact, householderScalars, signature );
-            lastZ = QRFact( IR(0,n), IR(0,n) );
+            lastZ = QRFact( IR(0,height), ALL );
+            MakeTrapezoidal( UPPER, lastZ );
         }
     }
+    if( parent != -1 )
+        SendRows( lastZ, parent, colComm );
 }
 
 template<typename F>
@@ -199,58 +275,60 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
     if( p == 1 )
         return;
     const Int rank = mpi::Rank( colComm );
-    if( m < p*n )
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
-
-    // Run the binary tree scatter
-    Matrix<F> Z(2*n,n,2*n), ZHalf(n,n,n);
-    if( rank == 0 )
-        Z = RootQR( A, treeData );
-    auto ZTop = Z( IR(0,n),   IR(0,n) );
-    auto ZBot = Z( IR(n,2*n), IR(0,n) );
-    for( Int revStage=0; revStage<logp; ++revStage )
+    if( m < n )
+        LogicError("TSQR currently assumes height >= width");
+
+    Int parent;
+    vector<Int> children;
+    TreeNeighbors( rank, p, treeData.ctrl, parent, children );
+    const Int numChildren = children.size();
+
+    // Recompute the heights of the triangular factors of each merge
+    vector<Int> topHeights(numChildren), childHeights(numChildren);
+    Int height = Min( A.LocalHeight(), n );
+    for( Int c=0; c<numChildren; ++c )
     {
-        const Int stage = (logp-1)-revStage;
-        // Skip this stage if the first stage bits of our rank are not zero
-        if( stage>0 && (Unsigned(rank) & ((Unsigned(1)<<stage)-1)) )
-            continue;
-
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
+        topHeights[c] = height;
+        childHeights[c] =
+          SubtreeHeight( children[c], p, m, n, A.ColAlign(), treeData.ctrl );
+        height = Min( height+childHeights[c], n );
+    }
+
+    // Receive our portion of the root's (explicit) factor from our parent
+    Matrix<F> ZHalf, Z;
+    if( parent != -1 )
+        RecvRows( ZHalf, height, n, parent, colComm );
+
+    // Undo the merges in reverse order
+    for( Int c=numChildren-1; c>=0; --c )
+    {
+        if( parent == -1 && c == numChildren-1 )
         {
-            if( stage < logp-1 )
-            {
-                // Multiply by the current Q
-                ZTop = ZHalf;
-                Zero( ZBot );
-
-                // TODO: Exploit sparsity?
-                ApplyQ
-                ( LEFT, NORMAL,
-                  treeData.QRList[stage],
-                  treeData.householderScalarsList[stage],
-                  treeData.signatureList[stage],
-                  Z );
-            }
-            // Send bottom-half to partner and keep top half
-            ZHalf = ZBot;
-            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm );
-            ZHalf = ZTop;
+            Z = RootQR( A, treeData );
         }
         else
         {
-            // Recv top half from partner
-            mpi::Recv( ZHalf.Buffer(), n*n, partner, colComm );
+            // Multiply by the current Q
+            Zeros( Z, topHeights[c]+childHeights[c], n );
+            auto ZTop = Z( IR(0,ZHalf.Height()), ALL );
+            ZTop = ZHalf;
+
+            // TODO: Exploit sparsity?
+            ApplyQ
+            ( LEFT, NORMAL,
+              treeData.QRList[c],
+              treeData.householderScalarsList[c],
+              treeData.signatureList[c],
+              Z );
         }
+        // Send the bottom rows to the child and keep the top rows
+        SendRows( Z(IR(topHeights[c],END),ALL), children[c], colComm );
+        ZHalf = Z( IR(0,topHeights[c]), ALL );
     }
 
     // Apply the initial Q
     Zero( A );
-    auto ATop = A.Matrix()( IR(0,n), IR(0,n) );
+    auto ATop = A.Matrix()( IR(0,ZHalf.Height()), ALL );
     ATop = ZHalf;
 
     // TODO: Exploit sparsity
@@ -316,11 +394,12 @@ FormQ( AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 } // namespace ts
 
 template<typename F>
-TreeData<F> TS( const AbstractDistMatrix<F>& A )
+TreeData<F> TS( const AbstractDistMatrix<F>& A, const TSQRCtrl& ctrl )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
     TreeData<F> treeData;
+    treeData.ctrl = ctrl;
     treeData.QR0 = A.LockedMatrix();
     QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
 
@@ -338,9 +417,12 @@ TreeData<F> TS( const AbstractDistMatrix<F>& A )
 }
 
 template<typename F>
-void ExplicitTS( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R )
+void ExplicitTS
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& R,
+  const TSQRCtrl& ctrl )
 {
-    auto treeData = TS( A );
+    auto treeData = TS( A, ctrl );
     Copy( ts::FormR( A, treeData ), R );
     ts::FormQ( A, treeData );
 }
@@ -229,8 +229,7 @@ BlackBox
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    // TODO(poulson): Extend interface to support accepting ctrl.tridiagCtrl
-    herm_tridiag::ExplicitCondensed( uplo, A );
+    herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -546,16 +545,24 @@ BlackBox
     DEBUG_CSE
     HermitianEigInfo info;
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
+    const bool twoStage =
+      ( ctrl.tridiagCtrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE );
     Matrix<F> householderScalars;
-    HermitianTridiag( uplo, A, householderScalars );
+    herm_tridiag::TwoStageData<F> twoStageData;
+    if( twoStage )
+        herm_tridiag::TwoStage( uplo, A, twoStageData, ctrl.tridiagCtrl );
+    else
+        HermitianTridiag( uplo, A, householderScalars );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
     info.tridiagEigInfo =
       HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
 
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    if( twoStage )
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, twoStageData, Q );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
 
     return info;
 }
@@ -576,9 +583,14 @@ BlackBox
     DistMatrixReadProxy<F,F,MC,MR> AProx( APre ); 
     auto& A = AProx.Get();
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
+    const bool twoStage =
+      ( ctrl.tridiagCtrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE );
     DistMatrix<F,VC,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars );
+    herm_tridiag::TwoStageData<F> twoStageData;
+    if( twoStage )
+        herm_tridiag::TwoStage( uplo, A, twoStageData, ctrl.tridiagCtrl );
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -590,7 +602,11 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        if( twoStage )
+            herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, twoStageData, Q );
+        else
+            herm_tridiag::ApplyQ
+            ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     }
     else
     {
@@ -599,7 +615,11 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        if( twoStage )
+            herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, twoStageData, Q );
+        else
+            herm_tridiag::ApplyQ
+            ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     }
 
     return info;
@@ -859,8 +879,14 @@ MRRR
         if( A.Grid().Rank() == 0 )
             timer.Start();
     }
+    const bool twoStage =
+      ( ctrl.tridiagCtrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE );
     DistMatrix<F,STAR,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
+    herm_tridiag::TwoStageData<F> twoStageData;
+    if( twoStage )
+        herm_tridiag::TwoStage( uplo, A, twoStageData, ctrl.tridiagCtrl );
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -980,7 +1006,10 @@ MRRR
             timer.Start();
         }
     }
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    if( twoStage )
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, twoStageData, Q );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -0,0 +1,352 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace randomized_svd {
+
+// The tall-skinny bases are stored as either sequential matrices or [VC,STAR]
+// matrices, while every small (square or nearly square) matrix is replicated.
+
+template<typename F>
+Matrix<F> EmptyLike( const Matrix<F>& A )
+{ return Matrix<F>(); }
+
+template<typename F>
+DistMatrix<F,VC,STAR> EmptyLike( const DistMatrix<F,VC,STAR>& A )
+{ return DistMatrix<F,VC,STAR>( A.Grid() ); }
+
+// Z := X^H Y
+template<typename F>
+void InnerProduct( const Matrix<F>& X, const Matrix<F>& Y, Matrix<F>& Z )
+{
+    DEBUG_CSE
+    Gemm( ADJOINT, NORMAL, F(1), X, Y, Z );
+}
+
+template<typename F>
+void InnerProduct
+( const DistMatrix<F,VC,STAR>& X,
+  const DistMatrix<F,VC,STAR>& Y,
+        Matrix<F>& Z )
+{
+    DEBUG_CSE
+    Zeros( Z, X.Width(), Y.Width() );
+    Gemm( ADJOINT, NORMAL, F(1), X.LockedMatrix(), Y.LockedMatrix(), F(0), Z );
+    El::AllReduce( Z, X.ColComm() );
+}
+
+// Y := X M
+template<typename F>
+void Update( const Matrix<F>& X, const Matrix<F>& M, Matrix<F>& Y )
+{
+    DEBUG_CSE
+    Gemm( NORMAL, NORMAL, F(1), X, M, Y );
+}
+
+template<typename F>
+void Update
+( const DistMatrix<F,VC,STAR>& X,
+  const Matrix<F>& M,
+        DistMatrix<F,VC,STAR>& Y )
+{
+    DEBUG_CSE
+    Y.Empty();
+    Y.AlignWith( X );
+    Y.Resize( X.Height(), M.Width() );
+    Gemm( NORMAL, NORMAL, F(1), X.LockedMatrix(), M, F(0), Y.Matrix() );
+}
+
+// Y := Y inv(R)^H
+template<typename F>
+void AdjointSolve( const Matrix<F>& R, Matrix<F>& Y )
+{
+    DEBUG_CSE
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, F(1), R, Y );
+}
+
+template<typename F>
+void AdjointSolve( const Matrix<F>& R, DistMatrix<F,VC,STAR>& Y )
+{
+    DEBUG_CSE
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, F(1), R, Y.Matrix() );
+}
+
+// Overwrite Y with an orthonormal basis for its range, Y = Q R
+template<typename F>
+void Orthonormalize
+( Matrix<F>& Y, Matrix<F>& R, const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.ortho == RANDOMIZED_SVD_CHOLESKY_QR )
+    {
+        Matrix<F> RCorr;
+        qr::Cholesky( Y, R );
+        qr::Cholesky( Y, RCorr );
+        MakeTrapezoidal( UPPER, R );
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RCorr, R );
+    }
+    else
+    {
+        qr::Explicit( Y, R );
+    }
+}
+
+template<typename F>
+void Orthonormalize
+( DistMatrix<F,VC,STAR>& Y,
+  Matrix<F>& R,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DistMatrix<F,STAR,STAR> R_STAR_STAR( Y.Grid() );
+    if( ctrl.ortho == RANDOMIZED_SVD_CHOLESKY_QR )
+    {
+        DistMatrix<F,STAR,STAR> RCorr( Y.Grid() );
+        qr::Cholesky( Y, R_STAR_STAR );
+        qr::Cholesky( Y, RCorr );
+        R = R_STAR_STAR.Matrix();
+        MakeTrapezoidal( UPPER, R );
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RCorr.Matrix(), R );
+    }
+    else
+    {
+        qr::ExplicitTS( Y, R_STAR_STAR, ctrl.tsqrCtrl );
+        R = R_STAR_STAR.Matrix();
+    }
+}
+
+// Given functions for forming Y := A X and Y := A^H X, compute an
+// approximate rank-k SVD of the m x n matrix A, A ~= U diag(s) V^H
+template<typename F,class Block,class ApplyFunc,class ApplyAdjFunc>
+void Kernel
+( Int m, Int n,
+  const ApplyFunc& applyA,
+  const ApplyAdjFunc& applyAAdj,
+  Block& U,
+  Matrix<Base<F>>& s,
+  Block& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int minDim = Min(m,n);
+    const Int k = ctrl.rank;
+    if( k < 0 || k > minDim )
+        LogicError("Invalid rank of ",k," for a ",m," x ",n," matrix");
+    if( ctrl.oversample < 0 || ctrl.numPowerIts < 0 )
+        LogicError("Oversampling and power iterations must be non-negative");
+    const Int l = Min(k+ctrl.oversample,minDim);
+
+    // Q := orth(A Omega)
+    auto Q = EmptyLike( U );
+    auto Z = EmptyLike( U );
+    Matrix<F> R;
+    Gaussian( Z, n, l );
+    applyA( Z, Q );
+
+    // BAdj := (Q^H A)^H
+    auto BAdj = EmptyLike( U );
+    if( ctrl.singlePass )
+    {
+        // Sketch the co-range as well, W := Psi A, with l' = 2 l + 1
+        // following the recommendation of Tropp et al.
+        const Int lCo = Min(2*l+1,m);
+        auto PsiAdj = EmptyLike( U );
+        auto WAdj = EmptyLike( U );
+        Gaussian( PsiAdj, m, lCo );
+        applyAAdj( PsiAdj, WAdj );
+        Orthonormalize( Q, R, ctrl );
+
+        // Q^H A ~= pinv(Psi Q) W, where Psi Q = Q2 R2, so that
+        // (Q^H A)^H ~= W^H Q2 inv(R2)^H
+        Matrix<F> PsiQ, R2;
+        InnerProduct( PsiAdj, Q, PsiQ );
+        qr::Explicit( PsiQ, R2 );
+        Update( WAdj, PsiQ, BAdj );
+        AdjointSolve( R2, BAdj );
+    }
+    else
+    {
+        Orthonormalize( Q, R, ctrl );
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            applyAAdj( Q, Z );
+            Orthonormalize( Z, R, ctrl );
+            applyA( Z, Q );
+            Orthonormalize( Q, R, ctrl );
+        }
+        applyAAdj( Q, BAdj );
+    }
+
+    // (Q^H A)^H = P T, so that Q^H A = T^H P^H = (UB S) (P VB)^H
+    Orthonormalize( BAdj, R, ctrl );
+    Matrix<F> TAdj, UB, VB;
+    Adjoint( R, TAdj );
+    SVD( TAdj, UB, s, VB, ctrl.svdCtrl );
+    s.Resize( k, 1 );
+    UB.Resize( UB.Height(), k );
+    VB.Resize( VB.Height(), k );
+    Update( Q, UB, U );
+    Update( BAdj, VB, V );
+}
+
+} // namespace randomized_svd
+
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      { Gemm( NORMAL, NORMAL, F(1), A, X, Y ); };
+    auto applyAAdj =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      { Gemm( ADJOINT, NORMAL, F(1), A, X, Y ); };
+    randomized_svd::Kernel<F>
+    ( A.Height(), A.Width(), applyA, applyAAdj, U, s, V, ctrl );
+}
+
+template<typename F>
+void RandomizedSVD
+( const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& UPre,
+        AbstractDistMatrix<Base<F>>& sPre,
+        AbstractDistMatrix<F>& VPre,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,VC,STAR> UProx( UPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR> sProx( sPre );
+    DistMatrixWriteProxy<F,F,VC,STAR> VProx( VPre );
+    auto& A = AProx.GetLocked();
+    auto& U = UProx.Get();
+    auto& s = sProx.Get();
+    auto& V = VProx.Get();
+
+    auto applyA =
+      [&]( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,VC,STAR>& Y )
+      { Gemm( NORMAL, NORMAL, F(1), A, X, Y ); };
+    auto applyAAdj =
+      [&]( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,VC,STAR>& Y )
+      { Gemm( ADJOINT, NORMAL, F(1), A, X, Y ); };
+    Matrix<Base<F>> sLoc;
+    randomized_svd::Kernel<F>
+    ( A.Height(), A.Width(), applyA, applyAAdj, U, sLoc, V, ctrl );
+    s.Resize( sLoc.Height(), 1 );
+    s.Matrix() = sLoc;
+}
+
+template<typename F>
+void RandomizedSVD
+( const SparseMatrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+          Zeros( Y, m, X.Width() );
+          Multiply( NORMAL, F(1), A, X, F(0), Y );
+      };
+    auto applyAAdj =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( ADJOINT, F(1), A, X, F(0), Y );
+      };
+    randomized_svd::Kernel<F>( m, n, applyA, applyAAdj, U, s, V, ctrl );
+}
+
+template<typename F>
+void RandomizedSVD
+( const DistSparseMatrix<F>& A,
+        DistMultiVec<F>& U,
+        Matrix<Base<F>>& s,
+        DistMultiVec<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    mpi::Comm comm = A.Comm();
+    const Grid grid( comm );
+
+    // The bases are kept in a [VC,STAR] distribution so that they can be
+    // orthonormalized with TSQR, and are only redistributed to and from
+    // multivectors for the sparse products
+    DistMultiVec<F> XMulti(comm), YMulti(comm);
+    auto applyA =
+      [&]( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,VC,STAR>& Y )
+      {
+          Copy( X, XMulti );
+          Zeros( YMulti, m, X.Width() );
+          Multiply( NORMAL, F(1), A, XMulti, F(0), YMulti );
+          Copy( YMulti, Y );
+      };
+    auto applyAAdj =
+      [&]( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,VC,STAR>& Y )
+      {
+          Copy( X, XMulti );
+          Zeros( YMulti, n, X.Width() );
+          Multiply( ADJOINT, F(1), A, XMulti, F(0), YMulti );
+          Copy( YMulti, Y );
+      };
+    DistMatrix<F,VC,STAR> U_VC_STAR(grid), V_VC_STAR(grid);
+    randomized_svd::Kernel<F>
+    ( m, n, applyA, applyAAdj, U_VC_STAR, s, V_VC_STAR, ctrl );
+    Copy( U_VC_STAR, U );
+    Copy( V_VC_STAR, V );
+}
+
+#define PROTO(F) \
+  template void RandomizedSVD \
+  ( const Matrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSVD \
+  ( const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& U, \
+          AbstractDistMatrix<Base<F>>& s, \
+          AbstractDistMatrix<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSVD \
+  ( const SparseMatrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSVD \
+  ( const DistSparseMatrix<F>& A, \
+          DistMultiVec<F>& U, \
+          Matrix<Base<F>>& s, \
+          DistMultiVec<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Products over the integers must be exact
+template<typename T,typename=DisableIf<IsField<T>>>
+Base<T> Tolerance( Int k )
+{ return Base<T>(0); }
+
+template<typename T,typename=EnableIf<IsField<T>>,typename=void>
+Base<T> Tolerance( Int k )
+{ return Base<T>(k+2)*limits::Epsilon<Base<T>>(); }
+
+// Compare the packed sequential Gemm used for datatypes which BLAS does not
+// support against the naive triple loop which it replaced (and, for the
+// datatypes which BLAS does support, against BLAS itself). The operands are
+// views into taller matrices so that their leading dimensions exceed their
+// heights.
+template<typename T>
+void TestBlasGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, Int ldPad, bool print )
+{
+    Output("Testing with ",TypeName<T>()," and (m,n,k)=(",m,",",n,",",k,")");
+    PushIndent();
+
+    const Int AHeight = ( orientA == NORMAL ? m : k );
+    const Int AWidth = ( orientA == NORMAL ? k : m );
+    const Int BHeight = ( orientB == NORMAL ? k : n );
+    const Int BWidth = ( orientB == NORMAL ? n : k );
+    Matrix<T> ABig, BBig, CBig, CNaiveBig, CPackedBig;
+    Uniform( ABig, AHeight+ldPad, AWidth, T(0), Base<T>(10) );
+    Uniform( BBig, BHeight+ldPad, BWidth, T(0), Base<T>(10) );
+    Uniform( CBig, m+ldPad, n, T(0), Base<T>(10) );
+    CNaiveBig = CBig;
+    CPackedBig = CBig;
+    auto A = ABig( IR(0,AHeight), ALL );
+    auto B = BBig( IR(0,BHeight), ALL );
+    auto C = CBig( IR(0,m), ALL );
+    auto CNaive = CNaiveBig( IR(0,m), ALL );
+    auto CPacked = CPackedBig( IR(0,m), ALL );
+    const T alpha = T(2);
+    const T beta = T(-1);
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+
+    const double flops = 2.*double(m)*double(n)*double(k);
+    const double gFlopScale = ( IsComplex<T>::value ? 4 : 1 ) / 1.e9;
+    Timer timer;
+
+    timer.Start();
+    blas::NaiveGemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(),  A.LDim(),
+             B.LockedBuffer(),  B.LDim(),
+      beta,  CNaive.Buffer(),   CNaive.LDim() );
+    const double naiveTime = timer.Stop();
+    Output
+    ("Naive:  ",naiveTime," seconds (",gFlopScale*flops/naiveTime,
+     " GFlop-equivalents/s)");
+
+    timer.Start();
+    blas::PackedGemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(),  A.LDim(),
+             B.LockedBuffer(),  B.LDim(),
+      beta,  CPacked.Buffer(),  CPacked.LDim() );
+    const double packedTime = timer.Stop();
+    Output
+    ("Packed: ",packedTime," seconds (",gFlopScale*flops/packedTime,
+     " GFlop-equivalents/s)");
+
+    timer.Start();
+    blas::Gemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(),  A.LDim(),
+             B.LockedBuffer(),  B.LDim(),
+      beta,  C.Buffer(),        C.LDim() );
+    const double gemmTime = timer.Stop();
+    Output
+    ("Gemm:   ",gemmTime," seconds (",gFlopScale*flops/gemmTime,
+     " GFlop-equivalents/s)");
+    if( print )
+    {
+        Print( CNaive, "CNaive" );
+        Print( CPacked, "CPacked" );
+        Print( C, "C" );
+    }
+
+    // Bound the magnitude of each entry of the result
+    const Base<T> entryBound =
+      Abs(alpha)*Base<T>(k)*MaxNorm(A)*MaxNorm(B) +
+      Abs(beta)*MaxNorm(CBig);
+    const Base<T> tol = Tolerance<T>(k)*entryBound;
+
+    CPacked -= CNaive;
+    const Base<T> packedError = MaxNorm( CPacked );
+    Output("|| CPacked - CNaive ||_max = ",packedError);
+    if( packedError > tol )
+        LogicError("Packed Gemm did not match the naive implementation");
+
+    C -= CNaive;
+    const Base<T> gemmError = MaxNorm( C );
+    Output("|| C - CNaive ||_max = ",gemmError);
+    if( gemmError > tol )
+        LogicError("Gemm did not match the naive implementation");
+
+    // The padding rows below each result must not have been touched
+    auto CPad = CPackedBig( IR(m,END), ALL );
+    auto CPadOrig = CBig( IR(m,END), ALL );
+    CPad -= CPadOrig;
+    if( ldPad > 0 && MaxNorm(CPad) != Base<T>(0) )
+        LogicError("Packed Gemm wrote outside of the result");
+
+    PopIndent();
+}
+
+// Run the requested product along with shapes which exercise the edge cases
+// of the packed kernel: an inner dimension smaller than the micro-panel
+// height and dimensions which are not multiples of the micro-tile dimensions
+template<typename T>
+void TestShapes
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, Int ldPad, bool print )
+{
+    TestBlasGemm<T>( orientA, orientB, m, n, k, ldPad, print );
+    TestBlasGemm<T>( orientA, orientB, 7, 9, 3, ldPad, print );
+    TestBlasGemm<T>( orientA, orientB, 13, 6, 5, ldPad, print );
+    TestBlasGemm<T>( orientA, orientB, 5, 17, 131, ldPad, print );
+    TestBlasGemm<T>( orientA, orientB, 67, 5, 9, ldPad, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        const Int m = Input("--m","height of result",200);
+        const Int n = Input("--n","width of result",200);
+        const Int k = Input("--k","inner dimension",200);
+        const Int ldPad = Input("--ldPad","padding of leading dimensions",3);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Orientation orientA = CharToOrientation( transA );
+        const Orientation orientB = CharToOrientation( transB );
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestShapes<Int>( orientA, orientB, m, n, k, ldPad, print );
+            TestShapes<double>( orientA, orientB, m, n, k, ldPad, print );
+            TestShapes<Complex<double>>
+            ( orientA, orientB, m, n, k, ldPad, print );
+#ifdef EL_HAVE_QD
+            TestShapes<DoubleDouble>
+            ( orientA, orientB, m, n, k, ldPad, print );
+            TestShapes<QuadDouble>( orientA, orientB, m, n, k, ldPad, print );
+            TestShapes<Complex<DoubleDouble>>
+            ( orientA, orientB, m, n, k, ldPad, print );
+            TestShapes<Complex<QuadDouble>>
+            ( orientA, orientB, m, n, k, ldPad, print );
+#endif
+#ifdef EL_HAVE_QUAD
+            TestShapes<Quad>( orientA, orientB, m, n, k, ldPad, print );
+            TestShapes<Complex<Quad>>
+            ( orientA, orientB, m, n, k, ldPad, print );
+#endif
+#ifdef EL_HAVE_MPC
+            TestShapes<BigFloat>( orientA, orientB, m, n, k, ldPad, print );
+            TestShapes<Complex<BigFloat>>
+            ( orientA, orientB, m, n, k, ldPad, print );
+#endif
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
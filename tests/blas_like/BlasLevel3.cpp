@@ -0,0 +1,358 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check the recursive Trsm/Trmm and blocked Syrk/Herk/Syr2k/Her2k used for
+// datatypes which BLAS does not support against products formed with the
+// naive triple-loop Gemm. The problem sizes should exceed the recursion and
+// blocking thresholds (64) so that the off-diagonal updates are exercised.
+
+template<typename T>
+Base<T> Tolerance( Int k )
+{ return Base<T>(10*k)*limits::Epsilon<Base<T>>(); }
+
+// Integer arithmetic is exact
+template<>
+Int Tolerance<Int>( Int k )
+{ return 0; }
+
+template<typename T>
+Base<T> MaxAbsDiff( const Matrix<T>& A, const Matrix<T>& B )
+{
+    Base<T> maxDiff = 0;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            maxDiff = Max( maxDiff, Abs(A(i,j)-B(i,j)) );
+    return maxDiff;
+}
+
+template<typename T>
+Base<T> MaxAbsEntry( const Matrix<T>& A )
+{
+    Base<T> maxAbs = 1;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            maxAbs = Max( maxAbs, Abs(A(i,j)) );
+    return maxAbs;
+}
+
+// Return the explicit triangle referenced by a Trmm/Trsm call
+template<typename T>
+Matrix<T> ExplicitTriangle( char uplo, char unit, const Matrix<T>& A )
+{
+    Matrix<T> ATri( A );
+    MakeTrapezoidal( CharToUpperOrLower(uplo), ATri );
+    if( unit == 'U' )
+        FillDiagonal( ATri, T(1) );
+    return ATri;
+}
+
+// Overwrite the 'uplo' triangle of C with that of CUpdate
+template<typename T>
+void CopyTriangle( char uplo, const Matrix<T>& CUpdate, Matrix<T>& C )
+{
+    const Int n = C.Height();
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = ( uplo == 'L' ? j : 0 );
+        const Int iEnd = ( uplo == 'L' ? n : j+1 );
+        for( Int i=iBeg; i<iEnd; ++i )
+            C(i,j) = CUpdate(i,j);
+    }
+}
+
+template<typename T>
+void CheckResult
+( const string& label, const Matrix<T>& X, const Matrix<T>& XRef,
+  Int k, bool print )
+{
+    if( print )
+    {
+        Print( XRef, label+" reference" );
+        Print( X, label );
+    }
+    const Base<T> error = MaxAbsDiff( X, XRef );
+    const Base<T> scale = MaxAbsEntry( XRef );
+    Output(label,": || X - XRef ||_max / || XRef ||_max = ",error/scale);
+    if( error > Tolerance<T>(k)*scale )
+        LogicError(label," did not match the naive reference");
+}
+
+template<typename T>
+void TestTrmm( Int m, Int n, bool print )
+{
+    const T alpha = T(2);
+    for( const char side : {'L','R'} )
+    for( const char uplo : {'L','U'} )
+    for( const char trans : {'N','T','C'} )
+    for( const char unit : {'N','U'} )
+    {
+        const Int dim = ( side == 'L' ? m : n );
+        Matrix<T> A, B;
+        Uniform( A, dim, dim, T(0), Base<T>(3) );
+        Uniform( B, m, n, T(0), Base<T>(3) );
+        const Matrix<T> ATri = ExplicitTriangle( uplo, unit, A );
+
+        Matrix<T> BRef;
+        Zeros( BRef, m, n );
+        if( side == 'L' )
+            blas::NaiveGemm
+            ( trans, 'N', m, n, m,
+              alpha, ATri.LockedBuffer(), ATri.LDim(),
+                     B.LockedBuffer(),    B.LDim(),
+              T(0),  BRef.Buffer(),       BRef.LDim() );
+        else
+            blas::NaiveGemm
+            ( 'N', trans, m, n, n,
+              alpha, B.LockedBuffer(),    B.LDim(),
+                     ATri.LockedBuffer(), ATri.LDim(),
+              T(0),  BRef.Buffer(),       BRef.LDim() );
+
+        blas::Trmm
+        ( side, uplo, trans, unit, m, n,
+          alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+        CheckResult
+        ( BuildString("Trmm(",side,uplo,trans,unit,")"), B, BRef, dim,
+          print );
+    }
+}
+
+template<typename F>
+void TestTrsm( Int m, Int n, bool print )
+{
+    const F alpha = F(2);
+    for( const char side : {'L','R'} )
+    for( const char uplo : {'L','U'} )
+    for( const char trans : {'N','T','C'} )
+    for( const char unit : {'N','U'} )
+    {
+        const Int dim = ( side == 'L' ? m : n );
+        // Keep the triangle well-conditioned by shrinking the off-diagonal
+        Matrix<F> A, B;
+        Uniform( A, dim, dim );
+        A *= F(1)/F(dim);
+        ShiftDiagonal( A, F(1) );
+        Uniform( B, m, n );
+        const Matrix<F> ATri = ExplicitTriangle( uplo, unit, A );
+
+        Matrix<F> X( B );
+        blas::Trsm
+        ( side, uplo, trans, unit, m, n,
+          alpha, A.LockedBuffer(), A.LDim(), X.Buffer(), X.LDim() );
+
+        // Form op(A) X (or X op(A)), which should equal alpha B
+        Matrix<F> BRef( B ), AX;
+        BRef *= alpha;
+        Zeros( AX, m, n );
+        if( side == 'L' )
+            blas::NaiveGemm
+            ( trans, 'N', m, n, m,
+              F(1), ATri.LockedBuffer(), ATri.LDim(),
+                    X.LockedBuffer(),    X.LDim(),
+              F(0), AX.Buffer(),         AX.LDim() );
+        else
+            blas::NaiveGemm
+            ( 'N', trans, m, n, n,
+              F(1), X.LockedBuffer(),    X.LDim(),
+                    ATri.LockedBuffer(), ATri.LDim(),
+              F(0), AX.Buffer(),         AX.LDim() );
+        CheckResult
+        ( BuildString("Trsm(",side,uplo,trans,unit,")"), AX, BRef, dim,
+          print );
+    }
+}
+
+template<typename T>
+void TestRankK( Int n, Int k, bool print )
+{
+    typedef Base<T> Real;
+    const T alpha = T(2);
+    const T beta = T(-1);
+    for( const char uplo : {'L','U'} )
+    for( const char trans : {'N','T','C'} )
+    {
+        const bool normal = ( trans == 'N' );
+        const bool adjoint = ( trans == 'C' );
+        const char transAdj = ( normal ? (IsComplex<T>::value ? 'C' : 'T')
+                                       : 'N' );
+        const char transSym = ( normal ? 'T' : 'N' );
+        const char transOp = ( normal ? 'N' : trans );
+
+        Matrix<T> A, B, C;
+        if( normal )
+        {
+            Uniform( A, n, k, T(0), Real(3) );
+            Uniform( B, n, k, T(0), Real(3) );
+        }
+        else
+        {
+            Uniform( A, k, n, T(0), Real(3) );
+            Uniform( B, k, n, T(0), Real(3) );
+        }
+        Uniform( C, n, n, T(0), Real(3) );
+        // Herk and Her2k assume that the diagonal of C is real
+        if( adjoint || (normal && IsComplex<T>::value) )
+            MakeDiagonalReal( C );
+
+        // The strictly opposite triangle of C must remain untouched, so
+        // each reference begins as a copy of C
+        Matrix<T> CRef, CExpected;
+        if( !adjoint )
+        {
+            // C := alpha op(A) op(A)^T + beta C
+            CRef = C;
+            blas::NaiveGemm
+            ( transOp, transSym, n, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     A.LockedBuffer(), A.LDim(),
+              beta,  CRef.Buffer(),    CRef.LDim() );
+            CExpected = C;
+            CopyTriangle( uplo, CRef, CExpected );
+            Matrix<T> CSyrk( C );
+            blas::Syrk
+            ( uplo, transOp, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+              beta,  CSyrk.Buffer(),   CSyrk.LDim() );
+            CheckResult
+            ( BuildString("Syrk(",uplo,transOp,")"), CSyrk, CExpected, k,
+              print );
+
+            // C := alpha op(A) op(B)^T + alpha op(B) op(A)^T + beta C
+            CRef = C;
+            blas::NaiveGemm
+            ( transOp, transSym, n, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     B.LockedBuffer(), B.LDim(),
+              beta,  CRef.Buffer(),    CRef.LDim() );
+            blas::NaiveGemm
+            ( transOp, transSym, n, n, k,
+              alpha, B.LockedBuffer(), B.LDim(),
+                     A.LockedBuffer(), A.LDim(),
+              T(1),  CRef.Buffer(),    CRef.LDim() );
+            CExpected = C;
+            CopyTriangle( uplo, CRef, CExpected );
+            Matrix<T> CSyr2k( C );
+            blas::Syr2k
+            ( uplo, transOp, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     B.LockedBuffer(), B.LDim(),
+              beta,  CSyr2k.Buffer(),  CSyr2k.LDim() );
+            CheckResult
+            ( BuildString("Syr2k(",uplo,transOp,")"), CSyr2k, CExpected,
+              2*k, print );
+        }
+        if( normal || adjoint )
+        {
+            const Real alphaReal = Real(2);
+            const Real betaReal = Real(-1);
+            const char transHerm = ( normal ? 'N' : 'C' );
+
+            // C := alpha op(A) op(A)^H + beta C
+            CRef = C;
+            blas::NaiveGemm
+            ( transHerm, transAdj, n, n, k,
+              T(alphaReal), A.LockedBuffer(), A.LDim(),
+                            A.LockedBuffer(), A.LDim(),
+              T(betaReal),  CRef.Buffer(),    CRef.LDim() );
+            CExpected = C;
+            CopyTriangle( uplo, CRef, CExpected );
+            Matrix<T> CHerk( C );
+            blas::Herk
+            ( uplo, transHerm, n, k,
+              alphaReal, A.LockedBuffer(), A.LDim(),
+              betaReal,  CHerk.Buffer(),   CHerk.LDim() );
+            CheckResult
+            ( BuildString("Herk(",uplo,transHerm,")"), CHerk, CExpected, k,
+              print );
+
+            // C := alpha op(A) op(B)^H + conj(alpha) op(B) op(A)^H + beta C
+            CRef = C;
+            blas::NaiveGemm
+            ( transHerm, transAdj, n, n, k,
+              alpha,       A.LockedBuffer(), A.LDim(),
+                           B.LockedBuffer(), B.LDim(),
+              T(betaReal), CRef.Buffer(),    CRef.LDim() );
+            blas::NaiveGemm
+            ( transHerm, transAdj, n, n, k,
+              Conj(alpha), B.LockedBuffer(), B.LDim(),
+                           A.LockedBuffer(), A.LDim(),
+              T(1),        CRef.Buffer(),    CRef.LDim() );
+            CExpected = C;
+            CopyTriangle( uplo, CRef, CExpected );
+            Matrix<T> CHer2k( C );
+            blas::Her2k
+            ( uplo, transHerm, n, k,
+              alpha,    A.LockedBuffer(), A.LDim(),
+                        B.LockedBuffer(), B.LDim(),
+              betaReal, CHer2k.Buffer(),  CHer2k.LDim() );
+            CheckResult
+            ( BuildString("Her2k(",uplo,transHerm,")"), CHer2k, CExpected,
+              2*k, print );
+        }
+    }
+}
+
+template<typename T>
+void TestMultiply( Int m, Int n, Int k, bool print )
+{
+    Output("Testing Trmm and rank-k updates with ",TypeName<T>());
+    PushIndent();
+    TestTrmm<T>( m, n, print );
+    TestRankK<T>( n, k, print );
+    PopIndent();
+}
+
+template<typename F>
+void TestAll( Int m, Int n, Int k, bool print )
+{
+    TestMultiply<F>( m, n, k, print );
+    Output("Testing Trsm with ",TypeName<F>());
+    PushIndent();
+    TestTrsm<F>( m, n, print );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--m","height of result",150);
+        const Int n = Input("--n","width of result",100);
+        const Int k = Input("--k","inner dimension",80);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            // Trsm is not instantiated over the integers
+            TestMultiply<Int>( m, n, k, print );
+#ifdef EL_HAVE_QD
+            TestAll<DoubleDouble>( m, n, k, print );
+            TestAll<QuadDouble>( m, n, k, print );
+            TestAll<Complex<DoubleDouble>>( m, n, k, print );
+            TestAll<Complex<QuadDouble>>( m, n, k, print );
+#endif
+#ifdef EL_HAVE_QUAD
+            TestAll<Quad>( m, n, k, print );
+            TestAll<Complex<Quad>>( m, n, k, print );
+#endif
+#ifdef EL_HAVE_MPC
+            TestAll<BigFloat>( m, n, k, print );
+            TestAll<Complex<BigFloat>>( m, n, k, print );
+#endif
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
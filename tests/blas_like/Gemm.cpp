@@ -142,6 +142,52 @@ void TestGemm
         TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
     PopIndent();
     
+    // Test the variant chosen by the cost model
+    const GemmAlgorithm alg =
+      SelectGemmAlgorithm
+      ( m, n, k, g, SerializedSize<T>(), GetGemmCostModel() );
+    C = COrig;
+    OutputFromRoot
+    (g.Comm(),"Cost-model algorithm (",
+     alg==GEMM_SUMMA_A ? "stationary A" :
+     alg==GEMM_SUMMA_B ? "stationary B" :
+     alg==GEMM_SUMMA_C ? "stationary C" : "dot product","):");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+
+    // Test the variant which splits the grid into layers
+    const Int depth = Gemm25DDepth( m, n, k, g, SerializedSize<T>() );
+    C = COrig;
+    OutputFromRoot(g.Comm(),"2.5D Algorithm with ",depth," layers:");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_25D );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+
     if( orientA == NORMAL && orientB == NORMAL )
     {
         // Test the variant of Gemm for panel-panel dot products
@@ -163,6 +209,26 @@ void TestGemm
             TestAssociativity
             ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
         PopIndent();
+
+        // Test the stationary C variant which overlaps communication
+        OutputFromRoot(g.Comm(),"Pipelined Stationary C Algorithm:");
+        PushIndent();
+        C = COrig;
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm( NORMAL, NORMAL, alpha, A, B, beta, C, GEMM_SUMMA_C_PIPELINED );
+        mpi::Barrier( g.Comm() );
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+        if( correctness )
+            TestAssociativity
+            ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        PopIndent();
     }
     PopIndent();
 }
@@ -191,6 +257,8 @@ main( int argc, char* argv[] )
         const Int rowAlignA = Input("--rowAlignA","row align of A",0);
         const Int rowAlignB = Input("--rowAlignB","row align of B",0); 
         const Int rowAlignC = Input("--rowAlignC","row align of C",0);
+        const bool calibrate =
+          Input("--calibrate","calibrate the Gemm cost model?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -201,6 +269,15 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        if( calibrate )
+        {
+            const GemmCostModel model = CalibrateGemmCostModel( g );
+            SetGemmCostModel( model );
+            OutputFromRoot
+            (comm,"Calibrated latency=",model.latency,
+             " [sec], inverse bandwidth=",model.inverseBandwidth,
+             " [sec/byte], flop time=",model.flopTime," [sec]");
+        }
 
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test Gemm",transA,transB);
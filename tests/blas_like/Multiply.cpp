@@ -45,6 +45,254 @@ void TestMultiply(Int m, Int n=1)
         Output("Test passed");
 }
 
+// Compare the sparse and pattern-only products against dense Gemm
+template<typename T>
+void TestAgainstDense( Orientation orientation, Int m, Int n, Int numRHS )
+{
+    DEBUG_CSE
+    typedef Base<T> Real;
+    Output
+    ("Testing ",OrientationToChar(orientation)," with ",TypeName<T>(),
+     " and ",numRHS," right-hand sides");
+
+    const Int numNonzerosPerRow = 5;
+    SparseMatrix<T> A;
+    Zeros( A, m, n );
+    A.Reserve( numNonzerosPerRow*m );
+    for( Int i=0; i<m; ++i )
+        for( Int k=0; k<numNonzerosPerRow; ++k )
+            A.QueueUpdate( i, SampleUniform<Int>(0,n), SampleUniform<T>() );
+    A.ProcessQueues();
+    const auto& G = A.LockedGraph();
+
+    Matrix<T> ADense, GDense;
+    Copy( A, ADense );
+    Zeros( GDense, m, n );
+    for( Int e=0; e<G.NumEdges(); ++e )
+        GDense.Set( G.Source(e), G.Target(e), T(1) );
+
+    const Int height = ( orientation == NORMAL ? n : m );
+    const Int width = ( orientation == NORMAL ? m : n );
+    Matrix<T> X, Y, YDense;
+    Uniform( X, height, numRHS );
+    Uniform( Y, width, numRHS );
+    const T alpha = T(3);
+    const T beta = T(-2);
+
+    YDense = Y;
+    Multiply( orientation, alpha, A, X, beta, Y );
+    Gemm( orientation, NORMAL, alpha, ADense, X, beta, YDense );
+    const Real YNorm = FrobeniusNorm( YDense );
+    YDense -= Y;
+    const Real error = FrobeniusNorm( YDense ) / YNorm;
+
+    Uniform( Y, width, numRHS );
+    YDense = Y;
+    Multiply( orientation, alpha, G, X, beta, Y );
+    Gemm( orientation, NORMAL, alpha, GDense, X, beta, YDense );
+    const Real YPatternNorm = FrobeniusNorm( YDense );
+    YDense -= Y;
+    const Real patternError = FrobeniusNorm( YDense ) / YPatternNorm;
+
+    const Real tol = numNonzerosPerRow*Max(m,n)*limits::Epsilon<Real>();
+    if( error > tol || patternError > tol )
+    {
+        Output("relative errors: ",error," and ",patternError);
+        RuntimeError("Sparse product did not match dense product");
+    }
+    else
+        Output("Test passed");
+}
+
+template<typename T>
+void RunDenseTests( Int m )
+{
+    for( const Orientation orientation : {NORMAL, TRANSPOSE, ADJOINT} )
+        for( const Int numRHS : {1, 4} )
+            TestAgainstDense<T>( orientation, m, m/2+1, numRHS );
+}
+
+// Return the maximum relative difference between the products y and yFrozen,
+// or infinity if they disagree on which entries are non-finite
+template<typename Real>
+Real FrozenError( const Matrix<Real>& y, const Matrix<Real>& yFrozen )
+{
+    Real scale = 1;
+    for( Int i=0; i<y.Height(); ++i )
+        if( limits::IsFinite(y(i)) )
+            scale = Max( scale, Abs(y(i)) );
+    Real error = 0;
+    for( Int i=0; i<y.Height(); ++i )
+    {
+        if( limits::IsFinite(y(i)) )
+        {
+            if( !limits::IsFinite(yFrozen(i)) )
+                return limits::Infinity<Real>();
+            error = Max( error, Abs(y(i)-yFrozen(i))/scale );
+        }
+        else if( std::isnan(y(i)) != std::isnan(yFrozen(i)) ||
+                 (!std::isnan(y(i)) && y(i) != yFrozen(i)) )
+            return limits::Infinity<Real>();
+    }
+    return error;
+}
+
+// Compare the products of a matrix with frozen sparsity, both with each
+// forced layout and with the heuristic choice, against those of the CSR
+// format. Roughly a third of the entries of the dense blocks are dropped so
+// that BCSR stores explicit zeros and the rows of SELL-C-sigma are padded,
+// and x has an infinite entry which the explicit zeros must not touch.
+template<typename Real>
+void TestFrozen( Int numBlockRows, Int blockSize, Int numIts )
+{
+    DEBUG_CSE
+    Output
+    ("Testing frozen sparsity with ",TypeName<Real>()," and ",
+     blockSize," x ",blockSize," blocks");
+    PushIndent();
+
+    // A block tridiagonal matrix with mostly-dense blocks
+    const Int n = numBlockRows*blockSize;
+    SparseMatrix<Real> A;
+    Zeros( A, n, n );
+    A.Reserve( 3*blockSize*n );
+    for( Int iBlock=0; iBlock<numBlockRows; ++iBlock )
+        for( Int jBlock=Max(iBlock-1,Int(0));
+             jBlock<=Min(iBlock+1,numBlockRows-1); ++jBlock )
+            for( Int i=iBlock*blockSize; i<(iBlock+1)*blockSize; ++i )
+                for( Int j=jBlock*blockSize; j<(jBlock+1)*blockSize; ++j )
+                    if( i == j || SampleUniform<Int>(0,3) != 0 )
+                        A.QueueUpdate( i, j, SampleUniform<Real>() );
+    A.ProcessQueues();
+
+    Matrix<Real> X, Y0;
+    Uniform( X, n, 1 );
+    X(n/2) = limits::Infinity<Real>();
+    Uniform( Y0, n, 1 );
+    const Real alpha = Real(3);
+    const Real beta = Real(-2);
+    auto Y( Y0 );
+    Multiply( NORMAL, alpha, A, X, beta, Y );
+
+    // Update a value after the first product, through a pointer which was
+    // returned before it, so that a stale copy of the values would be caught
+    auto AUpdated( A );
+    AUpdated.QueueUpdate( 0, 0, Real(1) );
+    AUpdated.ProcessQueues();
+    auto YUpdated( Y0 );
+    Multiply( NORMAL, alpha, AUpdated, X, beta, YUpdated );
+
+    // The heuristic is represented by an unset layout
+    vector<pair<SparseLayout,Int>> layouts =
+      { {SPARSE_CSR,-1}, {SPARSE_CSR,0}, {SPARSE_SELL,0} };
+    for( const Int bcsrSize : {2,3,4} )
+        if( n % bcsrSize == 0 )
+            layouts.push_back( pair<SparseLayout,Int>(SPARSE_BCSR,bcsrSize) );
+
+    const Real tol = 3*blockSize*n*limits::Epsilon<Real>();
+    double csrTime=0, heuristicTime=0;
+    for( const auto& layout : layouts )
+    {
+        const bool heuristic = ( layout.second == -1 );
+        auto AFrozen( A );
+        AFrozen.FreezeSparsity();
+        if( !heuristic )
+            AFrozen.SetMultLayout( layout.first, layout.second );
+        const SparseLayout chosenLayout = AFrozen.InitializeMultMeta().layout;
+        if( !heuristic && chosenLayout != layout.first )
+            LogicError("Frozen matrix did not use the requested layout");
+
+        Real* values = AFrozen.ValueBuffer();
+        auto YFrozen( Y0 );
+        Multiply( NORMAL, alpha, AFrozen, X, beta, YFrozen );
+        Real error = FrozenError( Y, YFrozen );
+        values[AFrozen.Offset(0,0)] += Real(1);
+        YFrozen = Y0;
+        Multiply( NORMAL, alpha, AFrozen, X, beta, YFrozen );
+        error = Max( error, FrozenError( YUpdated, YFrozen ) );
+
+        const string name = ( heuristic ? string("heuristic") :
+          ( layout.first == SPARSE_CSR ? string("CSR") :
+          ( layout.first == SPARSE_SELL ? string("SELL") :
+            BuildString("BCSR-",layout.second) ) ) );
+        Output(name,": relative error ",error);
+        if( error > tol )
+            RuntimeError("Frozen ",name," product did not match CSR product");
+
+        if( heuristic || layout.first == SPARSE_CSR )
+        {
+            Timer timer;
+            timer.Start();
+            for( Int it=0; it<numIts; ++it )
+                Multiply( NORMAL, alpha, AFrozen, X, Real(0), YFrozen );
+            (heuristic ? heuristicTime : csrTime) = timer.Stop() / numIts;
+        }
+    }
+    Output("CSR: ",csrTime," [sec], heuristic: ",heuristicTime," [sec]");
+    Output("Test passed");
+    PopIndent();
+}
+
+// Multiply the sum of the 1D Laplacian and the exchange matrix, whose
+// antidiagonal couples the first and last processes, against the
+// multivector with entries x(i,t) = (t+1)(i+1), which yields
+// y(i,t) = (t+1)(n-i+(i==n-1)(n+1)). The exchange of the remote entries
+// overlaps the multiplication of the rows which only need local entries.
+template<typename T>
+void TestDistMultiply( Int n, Int numRHS, mpi::Comm comm )
+{
+    DEBUG_CSE
+    typedef Base<T> Real;
+    OutputFromRoot
+    (comm,"Testing distributed product with ",TypeName<T>()," and ",
+     numRHS," right-hand sides");
+
+    DistSparseMatrix<T> A(comm);
+    Zeros( A, n, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 4*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( i > 0 )
+            A.QueueLocalUpdate( iLoc, i-1, T(-1) );
+        A.QueueLocalUpdate( iLoc, i, T(2) );
+        if( i < n-1 )
+            A.QueueLocalUpdate( iLoc, i+1, T(-1) );
+        A.QueueLocalUpdate( iLoc, n-1-i, T(1) );
+    }
+    A.ProcessLocalQueues();
+
+    DistMultiVec<T> X(n,numRHS,comm), Y(comm);
+    for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+        for( Int t=0; t<numRHS; ++t )
+            X.SetLocal( iLoc, t, T((t+1)*(X.GlobalRow(iLoc)+1)) );
+
+    Real error = 0;
+    for( const Orientation orientation : {NORMAL, TRANSPOSE} )
+    {
+        Ones( Y, n, numRHS );
+        Multiply( orientation, T(1), A, X, T(0), Y );
+        for( Int iLoc=0; iLoc<Y.LocalHeight(); ++iLoc )
+        {
+            const Int i = Y.GlobalRow(iLoc);
+            for( Int t=0; t<numRHS; ++t )
+            {
+                const T expected = T((t+1)*(n-i+(i==n-1 ? n+1 : 0)));
+                error = Max( error, Abs(Y.GetLocal(iLoc,t)-expected) );
+            }
+        }
+    }
+    error = mpi::AllReduce( error, mpi::MAX, comm );
+    if( error != Real(0) )
+    {
+        OutputFromRoot(comm,"maximum error: ",error);
+        RuntimeError("Distributed product was incorrect");
+    }
+    else
+        OutputFromRoot(comm,"Test passed");
+}
+
 void RunTests( Int m )
 {
     PushIndent();
@@ -52,6 +300,13 @@ void RunTests( Int m )
     TestMultiply<Complex<float>>(m);
     TestMultiply<double>(m);
     TestMultiply<Complex<double>>(m);
+    RunDenseTests<double>(m);
+    RunDenseTests<Complex<double>>(m);
+    for( const Int blockSize : {1, 3} )
+    {
+        TestFrozen<float>( m, blockSize, 10 );
+        TestFrozen<double>( m, blockSize, 10 );
+    }
 #ifdef EL_HAVE_QD
     TestMultiply<DoubleDouble>(m);
     TestMultiply<Complex<DoubleDouble>>(m);
@@ -81,6 +336,13 @@ int main( int argc, char* argv[] )
             Output("Testing with matrix height of ",m);
             RunTests(m);
         }
+
+        const mpi::Comm comm = mpi::COMM_WORLD;
+        for( const Int numRHS : {1, 3} )
+        {
+            TestDistMultiply<double>( 1000, numRHS, comm );
+            TestDistMultiply<Complex<double>>( 1000, numRHS, comm );
+        }
     }
     catch( exception& e ) { ReportException(e); }
     return 0;
@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <unistd.h>
+using namespace El;
+
+// A fresh file in the temporary directory rather than the working directory
+string TemporaryFilename()
+{
+    const char* tmpDir = std::getenv("TMPDIR");
+    const string pattern =
+      string(tmpDir==nullptr ? "/tmp" : tmpDir) + "/El-blocksizes-XXXXXX";
+    vector<char> filename( pattern.begin(), pattern.end() );
+    filename.push_back( '\0' );
+    const int fd = mkstemp( filename.data() );
+    if( fd == -1 )
+        RuntimeError("Could not create a file from ",pattern);
+    close( fd );
+    return string( filename.data() );
+}
+
+template<typename F>
+void TestTuning( Int n, const string& filename )
+{
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+
+    Matrix<F> A;
+    HermitianUniformSpectrum( A, n, 1, 10 );
+
+    ClearTunedBlocksizes();
+    SetBlocksizeTuning( true );
+    Timer timer;
+    auto AFact( A );
+    timer.Start();
+    Cholesky( LOWER, AFact );
+    const double tuneTime = timer.Stop();
+
+    // The second factorization should reuse the cached blocksize
+    AFact = A;
+    timer.Start();
+    Cholesky( LOWER, AFact );
+    const double cachedTime = timer.Stop();
+    SetBlocksizeTuning( false );
+
+    auto noTrial = []( Int bsize )
+      { LogicError("Cached blocksize was not reused"); };
+    const Int bsize = Blocksize<F>( "CholeskyLower", n, n, noTrial );
+    Output("tuned blocksize: ",bsize);
+    Output("tuning: ",tuneTime," [sec], cached: ",cachedTime," [sec]");
+
+    SaveTunedBlocksizes( filename );
+    ClearTunedBlocksizes();
+    if( Blocksize<F>( "CholeskyLower", n, n, noTrial, -1 ) != -1 )
+        LogicError("Tuned blocksizes were not cleared");
+    LoadTunedBlocksizes( filename );
+    if( Blocksize<F>( "CholeskyLower", n, n, noTrial ) != bsize )
+        LogicError("Tuned blocksize was not restored from ",filename);
+    if( Blocksize<F>( "CholeskyLower", n, n ) != bsize )
+        LogicError("Tuned blocksize was not used without a trial");
+
+    PopIndent();
+}
+
+// Every process factors its own copy of a [STAR,STAR] matrix, and each copy
+// must be identical even when autotuning is enabled
+template<typename F>
+void TestRedundant( Int n )
+{
+    Output("Testing redundant tuning with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A;
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+
+    ClearTunedBlocksizes();
+    SetBlocksizeTuning( true );
+    Cholesky( LOWER, A_STAR_STAR );
+    SetBlocksizeTuning( false );
+    ClearTunedBlocksizes();
+
+    Matrix<F> ARoot( A_STAR_STAR.Matrix() );
+    Broadcast( ARoot, A_STAR_STAR.RedundantComm(), 0 );
+    ARoot -= A_STAR_STAR.Matrix();
+    const Base<F> maxDiff =
+      mpi::AllReduce
+      ( MaxNorm(ARoot), mpi::MAX, A_STAR_STAR.RedundantComm() );
+    Output("maximum difference from the root's factor: ",maxDiff);
+    if( maxDiff != Base<F>(0) )
+        LogicError("Redundant factors differed between processes");
+
+    PopIndent();
+}
+
+void TestThreadLocal()
+{
+    Output("Testing thread-local blocksizes");
+    SetBlocksize( 96 );
+    SetBlocksize<double>( "LocalTrrk", 32 );
+    Int otherBlocksize=0, otherTrrkBlocksize=0;
+    std::thread thread
+    ( [&]()
+      {
+          PushBlocksizeStack( 17 );
+          SetLocalTrrkBlocksize<double>( 19 );
+          otherBlocksize = Blocksize();
+          otherTrrkBlocksize = LocalTrrkBlocksize<double>();
+      } );
+    thread.join();
+    if( otherBlocksize != 17 || otherTrrkBlocksize != 19 )
+        LogicError("Blocksizes were not set within the thread");
+    if( Blocksize() != 96 || LocalTrrkBlocksize<double>() != 32 )
+        LogicError("Blocksizes set within a thread leaked into another");
+    ClearBlocksize<double>( "LocalTrrk" );
+    if( LocalTrrkBlocksize<double>() != 64 )
+        LogicError("Clearing the blocksize did not restore the default");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","matrix dimension",500);
+        const string userFilename =
+          Input("--filename","tuned blocksize file",string(""));
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            const string filename =
+              ( userFilename.empty() ? TemporaryFilename() : userFilename );
+            TestThreadLocal();
+            TestTuning<float>( n, filename );
+            TestTuning<double>( n, filename );
+            TestTuning<Complex<double>>( n, filename );
+            if( userFilename.empty() )
+                std::remove( filename.c_str() );
+        }
+        TestRedundant<double>( n );
+        TestRedundant<Complex<double>>( n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+double ResizeLoop( Int n, Int nb, Int numIts )
+{
+    Timer timer;
+    timer.Start();
+    for( Int it=0; it<numIts; ++it )
+    {
+        for( Int k=0; k<n; k+=nb )
+        {
+            // Mimic the panel temporaries of a blocked factorization
+            Matrix<T> A1( n-k, Min(nb,n-k) );
+            Matrix<T> A2( Min(nb,n-k), n-k );
+            const size_t alignment = MemoryAlignment();
+            if( size_t(A1.Buffer()) % alignment != 0 ||
+                size_t(A2.Buffer()) % alignment != 0 )
+                LogicError("Buffer was not properly aligned");
+            A1.Set( 0, 0, T(1) );
+            A2.Set( 0, 0, A1.Get(0,0) );
+        }
+    }
+    return timer.Stop();
+}
+
+template<typename T>
+void TestMemory( Int n, Int nb, Int numIts, bool print )
+{
+    Output("Testing with ",TypeName<T>());
+
+    SetMemoryMode( SYSTEM_MEMORY_MODE );
+    ResetMemoryStats<T>();
+    const double systemTime = ResizeLoop<T>( n, nb, numIts );
+    const MemoryStats systemStats = GetMemoryStats<T>();
+    if( print )
+        PrintMemoryStats( systemStats, "System statistics" );
+
+    SetMemoryMode( POOLED_MEMORY_MODE );
+    ResetMemoryStats<T>();
+    const double pooledTime = ResizeLoop<T>( n, nb, numIts );
+    const MemoryStats pooledStats = GetMemoryStats<T>();
+    if( print )
+        PrintMemoryStats( pooledStats, "Pooled statistics" );
+    SetMemoryMode( SYSTEM_MEMORY_MODE );
+
+    if( pooledStats.numAllocs != pooledStats.numFrees )
+        LogicError("Pooled allocations were not all freed");
+    if( numIts > 1 && pooledStats.numPoolHits == 0 )
+        LogicError("Pool was never reused");
+    if( PooledBytes() != 0 )
+        LogicError("Returning to system mode did not release the pool");
+
+    // Aligning a power-of-two request must not push it into the next class
+    if( (sizeof(T) & (sizeof(T)-1)) == 0 )
+    {
+        SetMemoryMode( POOLED_MEMORY_MODE );
+        const size_t liveBytes = GetMemoryStats<T>().numBytesLive;
+        Matrix<T> B( 1024, 1 );
+        const size_t blockBytes = GetMemoryStats<T>().numBytesLive-liveBytes;
+        B.Empty();
+        SetMemoryMode( SYSTEM_MEMORY_MODE );
+        if( blockBytes != 1024*sizeof(T) )
+            LogicError
+            ("A request of ",1024*sizeof(T)," bytes reserved ",blockBytes);
+    }
+
+    // Blocks smaller than the minimum size class would never be reused, so
+    // they must bypass the pool
+    const size_t alignment = MemoryAlignment();
+    SetMemoryAlignment( alignof(T) );
+    Matrix<T> tiny( 1, 1 );
+    SetMemoryMode( POOLED_MEMORY_MODE );
+    tiny.Empty();
+    const size_t tinyPooledBytes = PooledBytes();
+    SetMemoryMode( SYSTEM_MEMORY_MODE );
+    SetMemoryAlignment( alignment );
+    if( tinyPooledBytes != 0 )
+        LogicError("A block below the minimum size class was pooled");
+
+    Output("  system: ",systemTime," [sec], pooled: ",pooledTime," [sec]");
+    Output("passed");
+}
+
+#ifdef EL_HAVE_MPC
+void TestBigFloatArena( Int n, Int nb, Int numIts )
+{
+    Output("Testing BigFloat arena mode");
+
+    mpfr::SetArenaMode( false );
+    ResetMemoryStats<BigFloat>();
+    const double systemTime = ResizeLoop<BigFloat>( n, nb, numIts );
+
+    mpfr::SetArenaMode( true );
+    ResetMemoryStats<BigFloat>();
+    const double arenaTime = ResizeLoop<BigFloat>( n, nb, numIts );
+
+    Matrix<BigFloat> A;
+    Uniform( A, n, nb );
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( !A(i,j).InArena() )
+                LogicError("Entry (",i,",",j,") was not arena-backed");
+
+    // Copies between arena-backed matrices move whole columns of limbs
+    Matrix<BigFloat> B( A );
+    for( Int j=0; j<B.Width(); ++j )
+        for( Int i=0; i<B.Height(); ++i )
+            if( !B(i,j).InArena() )
+                LogicError("Copied entry (",i,",",j,") was not arena-backed");
+    B -= A;
+    if( MaxNorm( B ) != BigFloat(0) )
+        LogicError("Copying an arena-backed matrix changed its entries");
+
+    // Moving out of the arena must copy the limbs, and increasing the
+    // precision of an entry must detach it from the arena
+    BigFloat alpha( std::move(A(0,0)) );
+    if( alpha.InArena() )
+        LogicError("Moved-from arena limbs were stolen");
+    A(0,0).SetPrecision( 2*mpfr::Precision() );
+    if( A(0,0).InArena() )
+        LogicError("Increasing the precision did not detach the entry");
+
+    // A detached entry must fall back to entrywise copies for its column
+    A(0,0) = alpha;
+    Matrix<BigFloat> C( A );
+    C -= A;
+    if( MaxNorm( C ) != BigFloat(0) )
+        LogicError("Copying a partially-detached matrix changed its entries");
+    mpfr::SetArenaMode( false );
+
+    Output("  per-entry: ",systemTime," [sec], arena: ",arenaTime," [sec]");
+    Output("passed");
+}
+#endif
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","matrix dimension",1000);
+        const Int nb = Input("--nb","panel width",96);
+        const Int numIts = Input("--numIts","number of sweeps",10);
+        const Int alignment = Input("--alignment","buffer alignment",64);
+        const bool print = Input("--print","print statistics?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SetMemoryAlignment( alignment );
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestMemory<float>( n, nb, numIts, print );
+            TestMemory<Complex<float>>( n, nb, numIts, print );
+
+            TestMemory<double>( n, nb, numIts, print );
+            TestMemory<Complex<double>>( n, nb, numIts, print );
+
+#ifdef EL_HAVE_QD
+            TestMemory<DoubleDouble>( n, nb, numIts, print );
+            TestMemory<QuadDouble>( n, nb, numIts, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+            TestMemory<Quad>( n, nb, numIts, print );
+            TestMemory<Complex<Quad>>( n, nb, numIts, print );
+#endif
+
+#ifdef EL_HAVE_MPC
+            TestMemory<BigInt>( n/10, nb, numIts, print );
+            TestMemory<BigFloat>( n/10, nb, numIts, print );
+            TestBigFloatArena( n/10, nb, numIts );
+#endif
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -9,11 +9,13 @@
 #include <El.hpp>
 using namespace El;
 
-template<typename F> 
+// The reflectors are either packed Householder scalars or the output of the
+// two-stage algorithm
+template<typename F,typename Reflectors>
 void TestCorrectness
 ( UpperOrLower uplo, 
   const Matrix<F>& A, 
-  const Matrix<F>& householderScalars,
+  const Reflectors& householderScalars,
         Matrix<F>& AOrig,
   bool print,
   bool display )
@@ -85,11 +87,11 @@ void TestCorrectness
         LogicError("Relative orthogonality error was unacceptably large");
 }
 
-template<typename F> 
+template<typename F,typename Reflectors>
 void TestCorrectness
 ( UpperOrLower uplo, 
   const DistMatrix<F>& A, 
-  const DistMatrix<F,STAR,STAR>& householderScalars,
+  const Reflectors& householderScalars,
         DistMatrix<F>& AOrig,
   bool print,
   bool display )
@@ -201,6 +203,36 @@ void InnerTestHermitianTridiag
     A = ACopy;
 }
 
+template<typename F>
+void InnerTestTwoStage
+( UpperOrLower uplo,
+        Matrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl,
+  bool correctness,
+  bool print,
+  bool display )
+{
+    Matrix<F> AOrig( A ), ACopy( A );
+    const Int m = A.Height();
+    herm_tridiag::TwoStageData<F> data;
+    Timer timer;
+
+    Output("Starting two-stage tridiagonalization...");
+    timer.Start();
+    herm_tridiag::TwoStage( uplo, A, data, ctrl );
+    const double runTime = timer.Stop();
+    const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
+    Output(runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( A, "A after two-stage HermitianTridiag" );
+    if( display )
+        Display( A, "A after two-stage HermitianTridiag" );
+    if( correctness )
+        TestCorrectness( uplo, A, data, AOrig, print, display );
+    A = ACopy;
+}
+
 template<typename F>
 void InnerTestHermitianTridiag
 ( UpperOrLower uplo,
@@ -242,10 +274,44 @@ void InnerTestHermitianTridiag
     A = ACopy;
 }
 
+template<typename F>
+void InnerTestTwoStage
+( UpperOrLower uplo,
+        DistMatrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl,
+  bool correctness,
+  bool print,
+  bool display )
+{
+    DistMatrix<F> AOrig( A ), ACopy( A );
+    const Int m = A.Height();
+    const Grid& g = A.Grid();
+    herm_tridiag::TwoStageData<F> data;
+    Timer timer;
+
+    OutputFromRoot(g.Comm(),"Starting two-stage tridiagonalization...");
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    herm_tridiag::TwoStage( uplo, A, data, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = timer.Stop();
+    const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot(g.Comm(),runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( A, "A after two-stage HermitianTridiag" );
+    if( display )
+        Display( A, "A after two-stage HermitianTridiag" );
+    if( correctness )
+        TestCorrectness( uplo, A, data, AOrig, print, display );
+    A = ACopy;
+}
+
 template<typename F>
 void TestHermitianTridiag
 ( UpperOrLower uplo,
   Int m,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -267,6 +333,12 @@ void TestHermitianTridiag
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, correctness, print, display );
 
+    Output("Sequential two-stage algorithm:");
+    HermitianTridiagCtrl<F> ctrl;
+    ctrl.approach = HERMITIAN_TRIDIAG_TWO_STAGE;
+    ctrl.bandwidth = bandwidth;
+    InnerTestTwoStage( uplo, A, ctrl, correctness, print, display );
+
     PopIndent();
 }
 
@@ -277,6 +349,7 @@ void TestHermitianTridiag
   Int m,
   Int nbLocal,
   bool avoidTrmv,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -314,6 +387,18 @@ void TestHermitianTridiag
     ctrl.order = COLUMN_MAJOR;
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, ctrl, correctness, print, display );
+
+    OutputFromRoot(g.Comm(),"Two-stage algorithm:");
+    ctrl.approach = HERMITIAN_TRIDIAG_TWO_STAGE;
+    ctrl.bandwidth = bandwidth;
+    InnerTestTwoStage( uplo, A, ctrl, correctness, print, display );
+
+    // Lower the limit on the redundantly-stored bulge-chasing reflectors so
+    // that the matrix exceeds it and the one-stage fallback is exercised
+    OutputFromRoot
+    (g.Comm(),"Two-stage algorithm beyond the reflector storage limit:");
+    ctrl.maxRedundantEntries = m;
+    InnerTestTwoStage( uplo, A, ctrl, correctness, print, display );
     PopIndent();
 }
 
@@ -333,6 +418,8 @@ main( int argc, char* argv[] )
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool avoidTrmv = 
           Input("--avoidTrmv","avoid Trmv local Symv",true);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for blocksize)",0);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -364,95 +451,106 @@ main( int argc, char* argv[] )
         {
             if( testReal )
                 TestHermitianTridiag<float>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<float>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
             if( testReal )
                 TestHermitianTridiag<double>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<double>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
 #ifdef EL_HAVE_QD
             if( testReal )
             {
                 TestHermitianTridiag<DoubleDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<QuadDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
             if( testCpx )
             {
                 TestHermitianTridiag<Complex<DoubleDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<Complex<QuadDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
 #endif
 
 #ifdef EL_HAVE_QUAD
             if( testReal )
                 TestHermitianTridiag<Quad>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<Quad>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
             if( testReal )
                 TestHermitianTridiag<BigFloat>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
         }
 
         if( testReal )
             TestHermitianTridiag<float>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<float>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
         if( testReal )
             TestHermitianTridiag<double>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
 #ifdef EL_HAVE_QD
         if( testReal )
         {
             TestHermitianTridiag<DoubleDouble>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<QuadDouble>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
         if( testCpx )
         {
             TestHermitianTridiag<Complex<DoubleDouble>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<Complex<QuadDouble>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
 #endif
 
 #ifdef EL_HAVE_QUAD
         if( testReal )
             TestHermitianTridiag<Quad>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<Quad>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         if( testReal )
             TestHermitianTridiag<BigFloat>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -25,6 +25,7 @@ void TestCorrectness
     const Real eps = limits::Epsilon<Real>();
     const Real oneNormAOrig = OneNorm( AOrig );
 
+    Output("Growth factor: ",lu::GrowthFactor(AOrig,A));
     Output("Testing error...");
     PushIndent();
 
@@ -35,7 +36,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -72,6 +73,8 @@ void TestCorrectness
     const Real eps = limits::Epsilon<Real>();
     const Real oneNormAOrig = OneNorm( AOrig );
 
+    const Real growth = lu::GrowthFactor( AOrig, A );
+    OutputFromRoot(g.Comm(),"Growth factor: ",growth);
     OutputFromRoot(g.Comm(),"Testing error...");
     PushIndent();
 
@@ -82,7 +85,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -135,6 +138,8 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+        LU( A, P, LU_TOURNAMENT );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
@@ -208,6 +213,8 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+        LU( A, P, LU_TOURNAMENT );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -260,7 +267,8 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int pivot =
+          Input("--pivot","0: none, 1: partial, 2: full, 3: tournament",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
@@ -272,7 +280,7 @@ main( int argc, char* argv[] )
 #endif
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
+        if( pivot < 0 || pivot > 3 )
             LogicError("Invalid pivot value");
 
 #ifdef EL_HAVE_MPC
@@ -291,6 +299,8 @@ main( int argc, char* argv[] )
             OutputFromRoot(g.Comm(),"Testing LU with partial pivoting");
         else if( pivot == 2 )
             OutputFromRoot(g.Comm(),"Testing LU with full pivoting");
+        else if( pivot == 3 )
+            OutputFromRoot(g.Comm(),"Testing LU with tournament pivoting");
 
         if( sequential && mpi::Rank() == 0 )
         {
@@ -28,6 +28,12 @@ int main( int argc, char* argv[] )
             ("--numSeqSeps",
              "number of separators to try per sequential partition",1);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const double amalgamationTol =
+          Input("--amalgamationTol","fraction of explicit zeros to allow",0.1);
+        const bool factor =
+          Input("--factor","factor and solve with amalgamation?",true);
+        const bool compareOrderings =
+          Input("--compareOrderings","compare orderings?",true);
         const bool print = Input("--print","print graph?",false);
         const bool display = Input("--display","display graph?",false);
         ProcessInput();
@@ -82,8 +88,77 @@ int main( int argc, char* argv[] )
         ldl::NestedDissection( graph, map, sep, info, ctrl );
 
         const int rootSepSize = info.size;
-        // TODO: Print more than just the root separator size
         OutputFromRoot(comm,rootSepSize," vertices in root separator");
+
+        // Compare the fronts of the local subtree with those resulting from
+        // amalgamation
+        OutputFromRoot(comm,"Running nested dissection with amalgamation");
+        ldl::DistNodeInfo amalgInfo;
+        ldl::DistSeparator amalgSep;
+        DistMap amalgMap;
+        ctrl.amalgamationTol = amalgamationTol;
+        ldl::NestedDissection( graph, amalgMap, amalgSep, amalgInfo, ctrl );
+        auto localRoot = []( const ldl::DistNodeInfo& rootInfo )
+          -> const ldl::NodeInfo&
+          {
+              const ldl::DistNodeInfo* node = &rootInfo;
+              while( node->child != nullptr )
+                  node = node->child;
+              return *node->duplicate;
+          };
+        const auto stats = ldl::GetFrontStats( localRoot(info) );
+        const auto amalgStats = ldl::GetFrontStats( localRoot(amalgInfo) );
+        if( mpi::Rank(comm) == 0 )
+        {
+            ldl::PrintFrontStats( stats, "Local fronts" );
+            ldl::PrintFrontStats( amalgStats, "Amalgamated local fronts" );
+        }
+
+        // Amalgamation introduces explicit zeros into the merged fronts, so
+        // ensure that factoring and solving with the amalgamated tree still
+        // yields an accurate solution of the (negative) 3D Laplacian
+        if( factor )
+        {
+            OutputFromRoot(comm,"Factoring with the amalgamated fronts");
+            DistSparseMatrix<double> A(comm);
+            Laplacian( A, n, n, n );
+            A *= -1.;
+            DistMap amalgInvMap;
+            InvertMap( amalgMap, amalgInvMap );
+            ldl::DistFront<double> front( A, amalgMap, amalgSep, amalgInfo );
+            LDL( amalgInfo, front, LDL_1D );
+
+            DistMultiVec<double> X( numVertices, 1, comm ),
+                                 Y( numVertices, 1, comm );
+            MakeUniform( X );
+            Zero( Y );
+            Multiply( NORMAL, 1., A, X, 0., Y );
+            ldl::SolveAfter( amalgInvMap, amalgInfo, front, Y );
+            Y -= X;
+            const double XNorm = FrobeniusNorm( X );
+            const double errorNorm = FrobeniusNorm( Y );
+            OutputFromRoot
+            (comm,"|| x - inv(A) A x ||_2 / || x ||_2 = ",errorNorm/XNorm);
+            if( errorNorm > Sqrt(limits::Epsilon<double>())*XNorm )
+                LogicError("Amalgamated solve was inaccurate");
+        }
+
+        // Predict the fill and work of nested dissection versus a single
+        // minimum-degree ordering of the entire graph
+        if( compareOrderings )
+        {
+            OutputFromRoot(comm,"Comparing orderings");
+            if( mpi::Rank(comm) == 0 )
+            {
+                Graph seqGraph;
+                CopyFromRoot( graph, seqGraph );
+                ctrl.amalgamationTol = 0;
+                const auto report = ldl::CompareOrderings( seqGraph, ctrl );
+                ldl::PrintOrderingReport( report );
+            }
+            else
+                CopyFromNonRoot( graph );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
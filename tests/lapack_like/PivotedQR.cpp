@@ -0,0 +1,325 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form an m x n matrix whose singular values decay geometrically
+template<typename F>
+void DecayingMatrix( Matrix<F>& A, Int m, Int n, Base<F> decay )
+{
+    const Int minDim = Min(m,n);
+    Matrix<F> X, Y;
+    Gaussian( X, m, minDim );
+    Gaussian( Y, minDim, n );
+    Matrix<Base<F>> d( minDim, 1 );
+    for( Int j=0; j<minDim; ++j )
+        d(j) = Pow( decay, Base<F>(j) );
+    DiagonalScale( RIGHT, NORMAL, d, X );
+    Gemm( NORMAL, NORMAL, F(1), X, Y, A );
+}
+
+template<typename F>
+void DecayingMatrix( DistMatrix<F>& A, Int m, Int n, Base<F> decay )
+{
+    const Grid& g = A.Grid();
+    const Int minDim = Min(m,n);
+    DistMatrix<F> X(g), Y(g);
+    Gaussian( X, m, minDim );
+    Gaussian( Y, minDim, n );
+    DistMatrix<Base<F>,MR,STAR> d( minDim, 1, g );
+    for( Int jLoc=0; jLoc<d.LocalHeight(); ++jLoc )
+        d.SetLocal( jLoc, 0, Pow( decay, Base<F>(d.GlobalRow(jLoc)) ) );
+    DiagonalScale( RIGHT, NORMAL, d, X );
+    Gemm( NORMAL, NORMAL, F(1), X, Y, A );
+}
+
+// Return ||A Omega^T - Q R||_F / ||A||_F and set the norm of the trailing
+// submatrix R(rank:end,rank:end), where R is only upper-triangular in its
+// leading numSteps columns if the factorization stopped early
+template<typename F>
+Base<F> FactorizationError
+( const Matrix<F>& QR,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+  const Permutation& Omega,
+  const Matrix<F>& AOrig,
+  Int rank,
+  Base<F>& trailingNorm )
+{
+    const Int numSteps = householderScalars.Height();
+    auto R( QR );
+    auto RL = R( ALL, IR(0,numSteps) );
+    MakeTrapezoidal( UPPER, RL );
+    auto R22 = R( IR(Min(rank,numSteps),END), IR(rank,END) );
+    trailingNorm = FrobeniusNorm( R22 );
+
+    auto E( R );
+    qr::ApplyQ( LEFT, NORMAL, QR, householderScalars, signature, E );
+    auto APerm( AOrig );
+    Omega.PermuteCols( APerm );
+    E -= APerm;
+    return FrobeniusNorm( E ) / FrobeniusNorm( AOrig );
+}
+
+template<typename F>
+Base<F> FactorizationError
+( const DistMatrix<F>& QR,
+  const DistMatrix<F,MD,STAR>& householderScalars,
+  const DistMatrix<Base<F>,MD,STAR>& signature,
+  const DistPermutation& Omega,
+  const DistMatrix<F>& AOrig,
+  Int rank,
+  Base<F>& trailingNorm )
+{
+    const Int numSteps = householderScalars.Height();
+    auto R( QR );
+    auto RL = R( ALL, IR(0,numSteps) );
+    MakeTrapezoidal( UPPER, RL );
+    auto R22 = R( IR(Min(rank,numSteps),END), IR(rank,END) );
+    trailingNorm = FrobeniusNorm( R22 );
+
+    auto E( R );
+    qr::ApplyQ( LEFT, NORMAL, QR, householderScalars, signature, E );
+    auto APerm( AOrig );
+    Omega.PermuteCols( APerm );
+    E -= APerm;
+    return FrobeniusNorm( E ) / FrobeniusNorm( AOrig );
+}
+
+template<typename F>
+void TestPivotedQR
+( Int m,
+  Int n,
+  Int rank,
+  Base<F> decay,
+  Int oversample,
+  double maxRatio,
+  Base<F> tol,
+  bool print )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> AOrig;
+    DecayingMatrix( AOrig, m, n, decay );
+    if( print )
+        Print( AOrig, "A" );
+
+    Real trailingNorms[2];
+    for( Int variant=0; variant<2; ++variant )
+    {
+        const bool randomized = ( variant == 1 );
+        QRCtrl<Real> ctrl;
+        ctrl.colPiv = true;
+        ctrl.randomized = randomized;
+        ctrl.oversample = oversample;
+
+        auto A( AOrig );
+        Matrix<F> householderScalars;
+        Matrix<Real> signature;
+        Permutation Omega;
+        Timer timer;
+        timer.Start();
+        QR( A, householderScalars, signature, Omega, ctrl );
+        const double runTime = timer.Stop();
+        Output
+        (randomized ? "Randomized: " : "Businger-Golub: ",runTime," seconds");
+        PushIndent();
+        const Real relError =
+          FactorizationError
+          ( A, householderScalars, signature, Omega, AOrig, rank,
+            trailingNorms[variant] );
+        Output("||A Omega^T - Q R||_F / ||A||_F = ",relError);
+        Output("||R22||_F = ",trailingNorms[variant]);
+        PopIndent();
+        if( relError > Real(100)*Max(m,n)*eps )
+            LogicError("Relative error was unacceptably large");
+    }
+    // Allow for the trailing norm of Businger-Golub being at roundoff level
+    const Real bgNorm = Max( trailingNorms[0], eps*FrobeniusNorm(AOrig) );
+    if( trailingNorms[1] > Real(maxRatio)*bgNorm )
+        LogicError
+        ("Randomized pivots were much worse than those of Businger-Golub");
+
+    // Stop the randomized factorization adaptively, which typically happens
+    // partway through a block of pivots
+    QRCtrl<Real> ctrl;
+    ctrl.colPiv = true;
+    ctrl.randomized = true;
+    ctrl.oversample = oversample;
+    ctrl.adaptive = true;
+    ctrl.tol = tol;
+    auto A( AOrig );
+    Matrix<F> householderScalars;
+    Matrix<Real> signature;
+    Permutation Omega;
+    QR( A, householderScalars, signature, Omega, ctrl );
+    const Int numSteps = householderScalars.Height();
+    Output("Adaptive randomized: ",numSteps," steps");
+    PushIndent();
+    Real trailingNorm;
+    const Real relError =
+      FactorizationError
+      ( A, householderScalars, signature, Omega, AOrig, numSteps,
+        trailingNorm );
+    Output("||A Omega^T - Q R||_F / ||A||_F = ",relError);
+    Output("||R22||_F = ",trailingNorm);
+    PopIndent();
+    if( relError > Real(100)*Max(m,n)*eps )
+        LogicError("Relative error was unacceptably large");
+    if( numSteps == Min(m,n) )
+        LogicError("The adaptive factorization did not stop early");
+    PopIndent();
+}
+
+template<typename F>
+void TestPivotedQR
+( const Grid& g,
+  Int m,
+  Int n,
+  Int rank,
+  Base<F> decay,
+  Int oversample,
+  double maxRatio,
+  Base<F> tol,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<F> AOrig(g);
+    DecayingMatrix( AOrig, m, n, decay );
+    if( print )
+        Print( AOrig, "A" );
+
+    Real trailingNorms[2];
+    for( Int variant=0; variant<2; ++variant )
+    {
+        const bool randomized = ( variant == 1 );
+        QRCtrl<Real> ctrl;
+        ctrl.colPiv = true;
+        ctrl.randomized = randomized;
+        ctrl.oversample = oversample;
+
+        auto A( AOrig );
+        DistMatrix<F,MD,STAR> householderScalars(g);
+        DistMatrix<Real,MD,STAR> signature(g);
+        DistPermutation Omega(g);
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        QR( A, householderScalars, signature, Omega, ctrl );
+        mpi::Barrier( g.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        OutputFromRoot
+        (g.Comm(),
+         randomized ? "Randomized: " : "Businger-Golub: ",runTime," seconds");
+        PushIndent();
+        const Real relError =
+          FactorizationError
+          ( A, householderScalars, signature, Omega, AOrig, rank,
+            trailingNorms[variant] );
+        OutputFromRoot(g.Comm(),"||A Omega^T - Q R||_F / ||A||_F = ",relError);
+        OutputFromRoot(g.Comm(),"||R22||_F = ",trailingNorms[variant]);
+        PopIndent();
+        if( relError > Real(100)*Max(m,n)*eps )
+            LogicError("Relative error was unacceptably large");
+    }
+    const Real bgNorm = Max( trailingNorms[0], eps*FrobeniusNorm(AOrig) );
+    if( trailingNorms[1] > Real(maxRatio)*bgNorm )
+        LogicError
+        ("Randomized pivots were much worse than those of Businger-Golub");
+
+    QRCtrl<Real> ctrl;
+    ctrl.colPiv = true;
+    ctrl.randomized = true;
+    ctrl.oversample = oversample;
+    ctrl.adaptive = true;
+    ctrl.tol = tol;
+    auto A( AOrig );
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    DistPermutation Omega(g);
+    QR( A, householderScalars, signature, Omega, ctrl );
+    const Int numSteps = householderScalars.Height();
+    OutputFromRoot(g.Comm(),"Adaptive randomized: ",numSteps," steps");
+    PushIndent();
+    Real trailingNorm;
+    const Real relError =
+      FactorizationError
+      ( A, householderScalars, signature, Omega, AOrig, numSteps,
+        trailingNorm );
+    OutputFromRoot(g.Comm(),"||A Omega^T - Q R||_F / ||A||_F = ",relError);
+    OutputFromRoot(g.Comm(),"||R22||_F = ",trailingNorm);
+    PopIndent();
+    if( relError > Real(100)*Max(m,n)*eps )
+        LogicError("Relative error was unacceptably large");
+    if( numSteps == Min(m,n) )
+        LogicError("The adaptive factorization did not stop early");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",300);
+        const Int rank = Input("--rank","rank of the trailing comparison",30);
+        const double decay =
+          Input("--decay","geometric decay of the singular values",0.8);
+        const Int oversample =
+          Input("--oversample","oversampling of the sketch",8);
+        const double maxRatio =
+          Input("--maxRatio","max ratio of randomized and BG trailing norms",
+                10.);
+        const double tol =
+          Input("--tol","relative tolerance of the adaptive tests",1e-4);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, gridHeight, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( sequential && mpi::Rank() == 0 )
+        {
+            TestPivotedQR<double>
+            ( m, n, rank, decay, oversample, maxRatio, tol, print );
+            TestPivotedQR<Complex<double>>
+            ( m, n, rank, decay, oversample, maxRatio, tol, print );
+        }
+
+        TestPivotedQR<float>
+        ( g, m, n, rank, float(decay), oversample, maxRatio, float(tol),
+          print );
+        TestPivotedQR<double>
+        ( g, m, n, rank, decay, oversample, maxRatio, tol, print );
+        TestPivotedQR<Complex<double>>
+        ( g, m, n, rank, decay, oversample, maxRatio, tol, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
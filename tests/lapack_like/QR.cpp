@@ -169,6 +169,8 @@ void TestQR
 ( const Grid& g,
   Int m,
   Int n,
+  bool caqr,
+  const TSQRCtrl& tsqrCtrl,
   bool correctness,
   bool print )
 {
@@ -189,7 +191,10 @@ void TestQR
     OutputFromRoot(g.Comm(),"Starting QR factorization...");
     mpi::Barrier( g.Comm() );
     const double startTime = mpi::Time();
-    QR( A, householderScalars, signature );
+    QRCtrl<Base<F>> ctrl;
+    ctrl.caqr = caqr;
+    ctrl.tsqrCtrl = tsqrCtrl;
+    QR( A, householderScalars, signature, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
@@ -220,6 +225,11 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",64);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool caqr = Input("--caqr","use TSQR for the panels?",false);
+        const Int tree =
+          Input("--tree","TSQR tree: 0: binary, 1: flat, 2: hybrid",0);
+        const Int groupSize =
+          Input("--groupSize","processes per group of hybrid TSQR tree",8);
         const bool correctness =
           Input("--correctness","test correctness?",true);
 #ifdef EL_HAVE_MPC
@@ -239,6 +249,9 @@ main( int argc, char* argv[] )
         const Grid g( comm, gridHeight, order );
         SetBlocksize( nb );
         ComplainIfDebug();
+        TSQRCtrl tsqrCtrl;
+        tsqrCtrl.tree = static_cast<TSQRTree>(tree);
+        tsqrCtrl.groupSize = groupSize;
 
         if( sequential && mpi::Rank() == 0 )
         {
@@ -280,39 +293,39 @@ main( int argc, char* argv[] )
         }
 
         TestQR<float>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
         TestQR<Complex<float>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
 
         TestQR<double>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
         TestQR<Complex<double>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
 
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
         TestQR<QuadDouble>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
 
         TestQR<Complex<DoubleDouble>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
         TestQR<Complex<QuadDouble>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestQR<Quad>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
         TestQR<Complex<Quad>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestQR<BigFloat>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
         TestQR<Complex<BigFloat>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, caqr, tsqrCtrl, correctness, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,330 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form A = Q1 diag(d) Q2^H, where d(j) = decay^j and Q1 and Q2 have
+// orthonormal columns
+template<typename F>
+void DecayingMatrix
+( Matrix<F>& A, Matrix<Base<F>>& d, Int m, Int n, Base<F> decay )
+{
+    const Int minDim = Min(m,n);
+    Matrix<F> Q1, Q2, R;
+    Gaussian( Q1, m, minDim );
+    Gaussian( Q2, n, minDim );
+    qr::Explicit( Q1, R );
+    qr::Explicit( Q2, R );
+    d.Resize( minDim, 1 );
+    for( Int j=0; j<minDim; ++j )
+        d(j) = Pow( decay, Base<F>(j) );
+    DiagonalScale( RIGHT, NORMAL, d, Q1 );
+    Gemm( NORMAL, ADJOINT, F(1), Q1, Q2, A );
+}
+
+template<typename F>
+void DecayingMatrix
+( DistMatrix<F>& A, Matrix<Base<F>>& d, Int m, Int n, Base<F> decay )
+{
+    const Grid& g = A.Grid();
+    const Int minDim = Min(m,n);
+    DistMatrix<F> Q1(g), Q2(g), R(g);
+    Gaussian( Q1, m, minDim );
+    Gaussian( Q2, n, minDim );
+    qr::Explicit( Q1, R );
+    qr::Explicit( Q2, R );
+    d.Resize( minDim, 1 );
+    for( Int j=0; j<minDim; ++j )
+        d(j) = Pow( decay, Base<F>(j) );
+    DistMatrix<Base<F>,STAR,STAR> d_STAR_STAR( minDim, 1, g );
+    d_STAR_STAR.Matrix() = d;
+    DiagonalScale( RIGHT, NORMAL, d_STAR_STAR, Q1 );
+    Gemm( NORMAL, ADJOINT, F(1), Q1, Q2, A );
+}
+
+// Return max_j |s(j)-d(j)| / d(0)
+template<typename Real>
+Real SingularValueError( const Matrix<Real>& s, const Matrix<Real>& d )
+{
+    Real error = 0;
+    for( Int j=0; j<s.Height(); ++j )
+        error = Max( error, Abs(s(j)-d(j)) );
+    return error / d(0);
+}
+
+// The optimal rank-k approximation error is the norm of the tail of d
+template<typename Real>
+Real TailNorm( const Matrix<Real>& d, Int k )
+{
+    auto dTail = d( IR(k,END), ALL );
+    return FrobeniusNorm( dTail );
+}
+
+template<typename F>
+void TestRandomizedSVD
+( Int m,
+  Int n,
+  Base<F> decay,
+  const RandomizedSVDCtrl<Base<F>>& ctrl,
+  double maxRatio,
+  bool print )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> A, U, V;
+    Matrix<Real> d, s;
+    DecayingMatrix( A, d, m, n, decay );
+    if( print )
+        Print( A, "A" );
+
+    Timer timer;
+    timer.Start();
+    RandomizedSVD( A, U, s, V, ctrl );
+    Output("RandomizedSVD: ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( U, "U" );
+        Print( s, "s" );
+        Print( V, "V" );
+    }
+
+    // E := A - U diag(s) V^H
+    auto E( A );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(-1), U, V, F(1), E );
+    const Real error = FrobeniusNorm( E );
+    const Real optimalError =
+      Max( TailNorm(d,ctrl.rank), Real(Max(m,n))*eps );
+    const Real sError = SingularValueError( s, d );
+    Output("||A - U S V^H||_F = ",error,", optimal = ",optimalError);
+    Output("max_j |s(j)-d(j)| / d(0) = ",sError);
+    if( error > Real(maxRatio)*optimalError )
+        LogicError("Low-rank approximation was unacceptably inaccurate");
+    PopIndent();
+}
+
+template<typename F>
+void TestRandomizedSVD
+( const Grid& g,
+  Int m,
+  Int n,
+  Base<F> decay,
+  const RandomizedSVDCtrl<Base<F>>& ctrl,
+  double maxRatio,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<F> A(g), U(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    Matrix<Real> d;
+    DecayingMatrix( A, d, m, n, decay );
+    if( print )
+        Print( A, "A" );
+
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    RandomizedSVD( A, U, s, V, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    OutputFromRoot(g.Comm(),"RandomizedSVD: ",runTime," seconds");
+    if( print )
+    {
+        Print( U, "U" );
+        Print( s, "s" );
+        Print( V, "V" );
+    }
+
+    auto E( A );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(-1), U, V, F(1), E );
+    const Real error = FrobeniusNorm( E );
+    const Real optimalError =
+      Max( TailNorm(d,ctrl.rank), Real(Max(m,n))*eps );
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( s );
+    const Real sError = SingularValueError( s_STAR_STAR.Matrix(), d );
+    OutputFromRoot
+    (g.Comm(),"||A - U S V^H||_F = ",error,", optimal = ",optimalError);
+    OutputFromRoot(g.Comm(),"max_j |s(j)-d(j)| / d(0) = ",sError);
+    if( error > Real(maxRatio)*optimalError )
+        LogicError("Low-rank approximation was unacceptably inaccurate");
+    PopIndent();
+}
+
+// A = diag(d) has known singular values, and the error of the low-rank
+// approximation can be measured through the product with the identity,
+// A - U S V^H = (A - U S V^H) I
+template<typename F>
+void TestSparseRandomizedSVD
+( Int n,
+  Base<F> decay,
+  const RandomizedSVDCtrl<Base<F>>& ctrl,
+  double maxRatio )
+{
+    typedef Base<F> Real;
+    Output("Testing sparse with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    SparseMatrix<F> A;
+    Zeros( A, n, n );
+    A.Reserve( n );
+    Matrix<Real> d( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        d(j) = Pow( decay, Real(j) );
+        A.QueueUpdate( j, j, F(d(j)) );
+    }
+    A.ProcessQueues();
+
+    Matrix<F> U, V;
+    Matrix<Real> s;
+    RandomizedSVD( A, U, s, V, ctrl );
+
+    Matrix<F> E;
+    Identity( E, n, n );
+    auto I( E );
+    Zeros( E, n, n );
+    Multiply( NORMAL, F(1), A, I, F(0), E );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(-1), U, V, F(1), E );
+    const Real error = FrobeniusNorm( E );
+    const Real optimalError = Max( TailNorm(d,ctrl.rank), Real(n)*eps );
+    Output("||A - U S V^H||_F = ",error,", optimal = ",optimalError);
+    Output("max_j |s(j)-d(j)| / d(0) = ",SingularValueError(s,d));
+    if( error > Real(maxRatio)*optimalError )
+        LogicError("Low-rank approximation was unacceptably inaccurate");
+    PopIndent();
+}
+
+template<typename F>
+void TestDistSparseRandomizedSVD
+( Int n,
+  Base<F> decay,
+  const RandomizedSVDCtrl<Base<F>>& ctrl,
+  double maxErrorRatio,
+  mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(comm,"Testing distributed sparse with ",TypeName<F>());
+    PushIndent();
+
+    DistSparseMatrix<F> A(comm);
+    Zeros( A, n, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, F(Pow(decay,Real(i))) );
+    }
+    A.ProcessLocalQueues();
+    Matrix<Real> d( n, 1 );
+    for( Int j=0; j<n; ++j )
+        d(j) = Pow( decay, Real(j) );
+
+    DistMultiVec<F> U(comm), V(comm);
+    Matrix<Real> s;
+    RandomizedSVD( A, U, s, V, ctrl );
+
+    // For a diagonal matrix, the error in the singular values is bounded by
+    // the error of the approximation
+    const Real sError = SingularValueError( s, d );
+    const Real optimalError =
+      Max( TailNorm(d,ctrl.rank), Real(n)*limits::Epsilon<Real>() );
+    OutputFromRoot(comm,"max_j |s(j)-d(j)| / d(0) = ",sError);
+    if( sError > Real(maxErrorRatio)*optimalError )
+        LogicError("Singular values were unacceptably inaccurate");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",200);
+        const Int n = Input("--width","width of matrix",100);
+        const Int rank = Input("--rank","rank of the approximation",10);
+        const Int oversample = Input("--oversample","oversampling",10);
+        const Int numPowerIts =
+          Input("--numPowerIts","number of power iterations",1);
+        const bool cholQR =
+          Input("--cholQR","orthonormalize with CholeskyQR2?",false);
+        const bool singlePass =
+          Input("--singlePass","use the single-pass variant?",false);
+        const double decay =
+          Input("--decay","geometric decay of the singular values",0.7);
+        const double maxRatio =
+          Input("--maxRatio","max ratio of error to the optimal error",10.);
+        const Int nb = Input("--nb","algorithmic blocksize",64);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, gridHeight, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        RandomizedSVDCtrl<float> ctrlFloat;
+        ctrlFloat.rank = rank;
+        ctrlFloat.oversample = oversample;
+        ctrlFloat.numPowerIts = numPowerIts;
+        ctrlFloat.ortho =
+          ( cholQR ? RANDOMIZED_SVD_CHOLESKY_QR : RANDOMIZED_SVD_HOUSEHOLDER );
+        ctrlFloat.singlePass = singlePass;
+        RandomizedSVDCtrl<double> ctrl;
+        ctrl.rank = rank;
+        ctrl.oversample = oversample;
+        ctrl.numPowerIts = numPowerIts;
+        ctrl.ortho = ctrlFloat.ortho;
+        ctrl.singlePass = singlePass;
+
+        if( sequential && mpi::Rank() == 0 )
+        {
+            TestRandomizedSVD<float>
+            ( m, n, float(decay), ctrlFloat, maxRatio, print );
+            TestRandomizedSVD<double>
+            ( m, n, decay, ctrl, maxRatio, print );
+            TestRandomizedSVD<Complex<double>>
+            ( m, n, decay, ctrl, maxRatio, print );
+            TestSparseRandomizedSVD<double>( n, decay, ctrl, maxRatio );
+            TestSparseRandomizedSVD<Complex<double>>
+            ( n, decay, ctrl, maxRatio );
+        }
+
+        TestRandomizedSVD<float>
+        ( g, m, n, float(decay), ctrlFloat, maxRatio, print );
+        TestRandomizedSVD<double>
+        ( g, m, n, decay, ctrl, maxRatio, print );
+        TestRandomizedSVD<Complex<double>>
+        ( g, m, n, decay, ctrl, maxRatio, print );
+        TestDistSparseRandomizedSVD<double>( n, decay, ctrl, maxRatio, comm );
+        TestDistSparseRandomizedSVD<Complex<double>>
+        ( n, decay, ctrl, maxRatio, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
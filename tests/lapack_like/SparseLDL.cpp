@@ -34,6 +34,9 @@ void TestSparseDirect
   bool solve2d,
   bool selInv,
   bool intraPiv, 
+  bool blr,
+  double blrTol,
+  Int blrTileSize,
   Int nbFact,
   Int nbSolve,
   bool natural,
@@ -155,7 +158,11 @@ void TestSparseDirect
     mpi::Barrier( comm );
     timer.Start();
     LDLFrontType type;
-    if( solve2d )
+    if( blr )
+    {
+        type = ( solve2d ? LDL_BLR_2D : LDL_BLR_1D );
+    }
+    else if( solve2d )
     {
         if( intraPiv )
             type = ( selInv ? LDL_INTRAPIV_SELINV_2D : LDL_INTRAPIV_2D );
@@ -169,7 +176,10 @@ void TestSparseDirect
         else
             type = ( selInv ? LDL_SELINV_1D : LDL_1D );
     }
-    LDL( info, front, type );
+    ldl::BLRCtrl<Real> blrCtrl;
+    blrCtrl.relTol = blrTol;
+    blrCtrl.tileSize = blrTileSize;
+    LDL( info, front, type, blrCtrl );
     mpi::Barrier( comm );
     const double factTime = timer.Stop();
     const double localFactGFlops = front.LocalFactorGFlops( selInv );
@@ -192,6 +202,29 @@ void TestSparseDirect
      "  max entries:   ",maxLocalEntriesAfter,"\n",Indent(),
      "  total entries: ",entriesAfter,"\n");
 
+    // Update-matrix workspace of the local subtree
+    const ldl::DistFront<F>* localFront = &front;
+    while( localFront->child != nullptr )
+        localFront = localFront->child;
+    const auto& localRoot = *localFront->duplicate;
+    if( localRoot.workPeak > localRoot.workPredicted )
+        LogicError
+        ("Used ",localRoot.workPeak," update entries but only predicted ",
+         localRoot.workPredicted);
+    const Int maxWorkPredicted =
+      mpi::AllReduce( localRoot.workPredicted, mpi::MAX, comm );
+    const Int maxWorkPeak = mpi::AllReduce( localRoot.workPeak, mpi::MAX, comm );
+    OutputFromRoot
+    (comm,
+     "Update workspace: \n",Indent(),
+     "  max predicted entries: ",maxWorkPredicted,"\n",Indent(),
+     "  max peak entries:      ",maxWorkPeak,"\n");
+
+    // The BLR factorization is only approximate and is refined below
+    DistMultiVec<F> YRefine(comm);
+    if( blr )
+        YRefine = Y;
+
     OutputFromRoot(comm,"Solving against Y...");
     SetBlocksize( nbSolve );
     mpi::Barrier( comm );
@@ -218,6 +251,36 @@ void TestSparseDirect
          "|| x     ||_2 = ",XNorms.Get(j,0),"\n",Indent(),
          "|| error ||_2 = ",errorNorms.Get(j,0),"\n",Indent(),
          "|| A x   ||_2 = ",YOrigNorms.Get(j,0),"\n");
+    // The BLR factorization is only checked after refinement
+    if( !blr )
+    {
+        const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+        for( int j=0; j<numRHS; ++j )
+            if( errorNorms.Get(j,0) > tol*XNorms.Get(j,0) )
+                LogicError
+                ("Relative error of right-hand side ",j," was ",
+                 errorNorms.Get(j,0)/XNorms.Get(j,0));
+    }
+
+    if( blr )
+    {
+        OutputFromRoot(comm,"Solving against Y with FGMRES...");
+        DistMultiVec<Real> reg( N, 1, comm );
+        Zero( reg );
+        RegSolveCtrl<Real> solveCtrl;
+        solveCtrl.maxIts = 20;
+        solveCtrl.restart = 10;
+        const Int numIts = reg_ldl::SolveAfter
+          ( A, reg, invMap, info, front, YRefine, solveCtrl );
+        YRefine -= X;
+        const Real errorNorm = FrobeniusNorm( YRefine );
+        const Real XNorm = FrobeniusNorm( X );
+        OutputFromRoot
+        (comm,numIts," iterations, || error ||_F / || x ||_F = ",
+         errorNorm/XNorm);
+        if( errorNorm > Pow(limits::Epsilon<Real>(),Real(0.25))*XNorm )
+            LogicError("The BLR-preconditioned solve did not converge");
+    }
 }
 
 int main( int argc, char* argv[] )
@@ -234,6 +297,10 @@ int main( int argc, char* argv[] )
         const bool solve2d = Input("--solve2d","use 2d solve?",false);
         const bool selInv = Input("--selInv","selectively invert?",false);
         const bool intraPiv = Input("--intraPiv","pivot within fronts?",false);
+        const bool blr = Input("--blr","compress the fronts (BLR)?",false);
+        const double blrTol =
+          Input("--blrTol","relative BLR compression tolerance",1e-4);
+        const Int blrTileSize = Input("--blrTileSize","BLR tile size",32);
         const bool natural = Input("--natural","analytical nested-diss?",true);
         const bool sequential = Input
             ("--sequential","sequential partitions?",true);
@@ -263,28 +330,34 @@ int main( int argc, char* argv[] )
         // TODO(poulson): Call complex variants as well
 
         TestSparseDirect<float>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv,
+          blr, blrTol, blrTileSize, nbFact, nbSolve,
           natural, cutoff, unpack, print, display, ctrl, comm );
         TestSparseDirect<double>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv,
+          blr, blrTol, blrTileSize, nbFact, nbSolve,
           natural, cutoff, unpack, print, display, ctrl, comm );
 #ifdef EL_HAVE_QD
         TestSparseDirect<DoubleDouble>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv,
+          blr, blrTol, blrTileSize, nbFact, nbSolve,
           natural, cutoff, unpack, print, display, ctrl, comm );
         TestSparseDirect<QuadDouble>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv,
+          blr, blrTol, blrTileSize, nbFact, nbSolve,
           natural, cutoff, unpack, print, display, ctrl, comm );
 #endif
 #ifdef EL_HAVE_QUAD
         TestSparseDirect<Quad>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv,
+          blr, blrTol, blrTileSize, nbFact, nbSolve,
           natural, cutoff, unpack, print, display, ctrl, comm );
 #endif
 #ifdef EL_HAVE_MPC
         mpfr::SetPrecision( prec );
         TestSparseDirect<BigFloat>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv,
+          blr, blrTol, blrTileSize, nbFact, nbSolve,
           natural, cutoff, unpack, print, display, ctrl, comm );
 #endif
     }
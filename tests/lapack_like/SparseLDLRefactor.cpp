@@ -14,26 +14,6 @@
 #include <El.hpp>
 using namespace El;
 
-template<typename F>
-void MakeFrontsUniform( ldl::Front<F>& front )
-{
-    ldl::ChangeFrontType( front, SYMM_2D );
-    MakeUniform( front.LDense );
-    for( ldl::Front<F>* child : front.children )
-        MakeFrontsUniform( *child );
-}
-
-template<typename F>
-void MakeFrontsUniform( ldl::DistFront<F>& front )
-{
-    ldl::ChangeFrontType( front, SYMM_2D );
-    MakeUniform( front.L2D );
-    if( front.child != nullptr )
-        MakeFrontsUniform( *front.child );
-    else
-        MakeFrontsUniform( *front.duplicate );
-}
-
 template<typename F>
 void TestSparseDirect
 ( Int n1,
@@ -80,18 +60,24 @@ void TestSparseDirect
     const Int rootSepSize = info.size;
     OutputFromRoot(comm,rootSepSize," vertices in root separator\n");
 
-    OutputFromRoot(comm,"Building ldl::DistFront tree...");
-    mpi::Barrier( comm );
-    timer.Start();
-    ldl::DistFront<F> front( A, map, sep, info, false );
-    mpi::Barrier( comm );
-    timer.Stop();
-    OutputFromRoot(comm,timer.Partial()," seconds");
-
+    // Repeatedly refactor matrices with the same sparsity pattern, reusing
+    // the metadata (and fronts) from the first pull
+    ldl::DistFront<F> front;
+    ldl::DistFrontPullMeta meta;
     for( Int repeat=0; repeat<numRepeats; ++repeat )
     {
         if( repeat != 0 )
-            MakeFrontsUniform( front );
+            A *= F(2);
+
+        OutputFromRoot(comm,"Pulling ldl::DistFront tree...");
+        mpi::Barrier( comm );
+        timer.Start();
+        front.Pull( A, map, sep, info, meta );
+        mpi::Barrier( comm );
+        timer.Stop();
+        OutputFromRoot
+        (comm,timer.Partial()," seconds (",meta.metaTime," forming metadata, ",
+         meta.valueTime," exchanging values)");
 
         OutputFromRoot(comm,"Running LDL^T and redistribution...");
         mpi::Barrier( comm );
@@ -108,12 +94,18 @@ void TestSparseDirect
         timer.Start();
         DistMultiVec<F> y( N, 1, comm );
         MakeUniform( y );
-        ldl::SolveAfter( invMap, info, front, y );
+        DistMultiVec<F> x( y );
+        ldl::SolveAfter( invMap, info, front, x );
         mpi::Barrier( comm );
         timer.Stop();
         OutputFromRoot(comm,"Time = ",timer.Partial()," seconds");
 
-        // TODO: Check residual error
+        const Base<F> yNorm = FrobeniusNorm( y );
+        Multiply( NORMAL, F(-1), A, x, F(1), y );
+        const Base<F> errorNorm = FrobeniusNorm( y );
+        OutputFromRoot(comm,"|| y - A x ||_2 / || y ||_2 = ",errorNorm/yNorm);
+        if( errorNorm > Pow(limits::Epsilon<Base<F>>(),Base<F>(0.5))*yNorm )
+            LogicError("Refactored solution was inaccurate");
     }
 }
 